@@ -233,28 +233,15 @@ public:
     /** Allocates memory from a memory pool for a new Activity */
     void* operator new(std::size_t size) noexcept
     {
-        /* 1) Find memory pool
+        /* 1) Find this thread's memory pool for the size class
          * 1.5) If not found, create new
          * 2) Alloc item from pool
          * 3) Append PoolID to item, increment pointer
          */
+        size_t sizeClass = (size + poolClassSize - 1) / poolClassSize;
         Core::MemPool *pool = nullptr;
-        size_t nPools = memPools.size();
-        std::thread::id tid = std::this_thread::get_id();
-        for ( size_t i = 0 ; i < nPools ; i++ ) {
-            PoolInfo_t &p = memPools[i];
-            if ( p.tid == tid && p.size == size ) {
-                pool = p.pool;
-                break;
-            }
-        }
-        if ( nullptr == pool ) {
-            /* Still can't find it, alloc a new one */
-            pool = new Core::MemPool(size+sizeof(PoolData_t));
-            
-            std::lock_guard<std::mutex> lock(poolMutex);
-            memPools.emplace_back(tid, size, pool);
-        }
+        if ( sizeClass < numPoolClasses ) pool = threadPools[sizeClass];
+        if ( nullptr == pool ) pool = findPool(sizeClass);
 
         PoolData_t *ptr = (PoolData_t*)pool->malloc();
         if ( !ptr ) {
@@ -296,6 +283,7 @@ public:
     static void getMemPoolUsage(uint64_t& bytes, uint64_t& active_activities) {
         bytes = 0;
         active_activities = 0;
+        std::lock_guard<std::mutex> lock(poolMutex);
         for ( auto && entry : Activity::memPools ) {
             bytes += entry.pool->getBytesMemUsed();
             active_activities += entry.pool->getUndeletedEntries();
@@ -370,6 +358,18 @@ private:
         PoolInfo_t(std::thread::id tid, size_t size, Core::MemPool *pool) : tid(tid), size(size), pool(pool)
         { }
     };
+
+    /* Allocation sizes are rounded up to a multiple of poolClassSize.
+     * Each thread has a direct lookup table of its pools for the
+     * first numPoolClasses size classes. */
+    static constexpr size_t poolClassSize = 16;
+    static constexpr size_t numPoolClasses = 128;
+    static thread_local Core::MemPool* threadPools[numPoolClasses];
+
+    /** Find or create the calling thread's pool for a size class */
+    static Core::MemPool* findPool(size_t sizeClass);
+
+    /* All pools, for reporting.  Only locked when a pool is created. */
     static std::mutex poolMutex;
     static std::vector<PoolInfo_t> memPools;
 #endif
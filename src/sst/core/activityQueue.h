@@ -32,6 +32,11 @@ public:
     virtual Activity* pop() = 0;
     /** Insert a new activity into the queue */
     virtual void insert(Activity* activity) = 0;
+    /** Insert a batch of activities into the queue.  Queues that can
+     * do better than one insert() per activity override this. */
+    virtual void insertBatch(Activity* const* batch, size_t count) {
+        for ( size_t i = 0; i < count; i++ ) insert(batch[i]);
+    }
     /** Returns the next activity */
     virtual Activity* front() = 0;
 
@@ -259,6 +259,14 @@ BaseComponent::getTimeConverter( const UnitAlgebra& base )
 }
 
 
+void
+BaseComponent::serialize_order(SST::Core::Serialization::serializer& UNUSED(ser))
+{
+    Simulation::getSimulationOutput().fatal(CALL_INFO, 1, "Component %s (%s) does not support checkpointing\n",
+            getName().c_str(), getType().c_str());
+}
+
+
 bool
 BaseComponent::isPortConnected(const std::string& name) const
 {
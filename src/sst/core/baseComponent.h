@@ -107,6 +107,17 @@ public:
      */
     virtual void printStatus(Output &UNUSED(out)) { return; }
 
+    /**
+     * Save or restore the state of this component in a checkpoint.
+     * Components opt in to checkpointing by overriding this; the
+     * default is a fatal error.  On a restart the state is restored
+     * instead of calling setup().  Clocks registered by the constructor
+     * are rescheduled from the restored time, so a component that had
+     * unregistered a clock or had a one-shot pending re-establishes that
+     * when unpacking.
+     */
+    virtual void serialize_order(SST::Core::Serialization::serializer& ser);
+
 #ifdef SST_ENABLE_PREVIEW_BUILD
 protected:
 #endif
@@ -261,7 +272,9 @@ protected:
         If Statistic is allowed to run (controlled by Python runtime parameters),
         then a statistic will be created and returned. If not allowed to run,
         then a NullStatistic will be returned.  In either case, the returned
-        value should be used for all future Statistic calls.  The type of
+        value should be used for all future Statistic calls.  A NullStatistic
+        is disabled, so calling addData() on it only tests a flag in the
+        inlined call and it can be left in performance critical code.  The type of
         Statistic and the Collection Rate is set by Python runtime parameters.
         If no type is defined, then an Accumulator Statistic will be provided
         by default.  If rate set to 0 or not provided, then the statistic will
@@ -0,0 +1,71 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#include "sst_config.h"
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
+
+#include "sst/core/config.h"
+#include "sst/core/configGraph.h"
+#include "sst/core/configGraphOutput.h"
+#include "sst/core/params.h"
+#include "sst/core/serialization/serializer.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace SST::Core;
+
+const char BinaryConfigGraphOutput::MAGIC[8] = { 'S', 'S', 'T', 'C', 'F', 'G', 'B', '\0' };
+
+BinaryConfigGraphOutput::BinaryConfigGraphOutput(const char* path) :
+    ConfigGraphOutput(path) {
+
+}
+
+void BinaryConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph) {
+
+    if(nullptr == outputFile) {
+        throw ConfigGraphOutputException("Output file is not open for writing");
+    }
+
+    std::vector<std::pair<std::string, std::string>> entries = cfg->model_config_entries;
+
+    SST::Core::Serialization::serializer ser;
+    ser.start_sizing();
+    ser & entries;
+    ser & Params::keyMap;
+    ser & Params::keyMapReverse;
+    ser & Params::nextKeyID;
+    ser & *graph;
+
+    std::vector<char> buffer(ser.size());
+    ser.start_packing(buffer.data(), buffer.size());
+    ser & entries;
+    ser & Params::keyMap;
+    ser & Params::keyMapReverse;
+    ser & Params::nextKeyID;
+    ser & *graph;
+
+    BinaryConfigHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.ranks = cfg->world_size.rank;
+    header.threads = cfg->world_size.thread;
+    header.size = buffer.size();
+    strncpy(header.partitioner, cfg->partitioner.c_str(), sizeof(header.partitioner) - 1);
+
+    if ( 1 != fwrite(&header, sizeof(header), 1, outputFile) ||
+         buffer.size() != fwrite(buffer.data(), 1, buffer.size(), outputFile) ) {
+        throw ConfigGraphOutputException("Unable to write the binary configuration");
+    }
+}
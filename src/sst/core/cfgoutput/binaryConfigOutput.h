@@ -0,0 +1,57 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#ifndef _SST_CORE_CONFIG_OUTPUT_BINARY
+#define _SST_CORE_CONFIG_OUTPUT_BINARY
+
+#include "sst/core/configGraph.h"
+#include "sst/core/configGraphOutput.h"
+
+#include <cstdint>
+
+namespace SST {
+namespace Core {
+
+/**
+   Writes the fully built (and partitioned) ConfigGraph with the core
+   serializer, so later runs can load it with SSTBinaryModelDefinition
+   instead of running the Python model again.  The file is a
+   BinaryConfigHeader followed by the serialized program options set by
+   the model, the Params key maps and the graph.
+*/
+class BinaryConfigGraphOutput : public ConfigGraphOutput {
+
+public:
+    static const char MAGIC[8];
+    static const uint32_t VERSION = 1;
+
+    struct BinaryConfigHeader {
+        char     magic[8];
+        uint32_t version;
+        /** Ranks and threads the graph was partitioned for */
+        uint32_t ranks;
+        uint32_t threads;
+        uint32_t reserved;
+        /** Bytes of serialized data after the header */
+        uint64_t size;
+        /** Partitioner used, NUL terminated */
+        char     partitioner[64];
+    };
+
+    BinaryConfigGraphOutput(const char* path);
+    virtual void generate(const Config* cfg, ConfigGraph* graph) override;
+};
+
+}
+}
+
+#endif
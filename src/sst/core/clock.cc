@@ -14,6 +14,7 @@
 
 #include "sst/core/simulation.h"
 #include "sst/core/timeConverter.h"
+#include "sst/core/timeVortex.h"
     
 namespace SST {
 
@@ -21,6 +22,7 @@ Clock::Clock( TimeConverter* period, int priority ) :
     Action(),
     currentCycle( 0 ),
     period( period ),
+    numHandlers( 0 ),
     scheduled( false )
 {
     setPriority(priority);
@@ -31,7 +33,7 @@ Clock::~Clock()
 {
     // Delete all the handlers
     for ( StaticHandlerMap_t::iterator it = staticHandlerMap.begin(); it != staticHandlerMap.end(); ++it ) {
-        delete *it;
+        if ( *it != nullptr ) delete *it;
     }
     staticHandlerMap.clear();
 }
@@ -39,7 +41,9 @@ Clock::~Clock()
 
 bool Clock::registerHandler( Clock::HandlerBase* handler )
 {
+    handler->clockSlot = staticHandlerMap.size();
     staticHandlerMap.push_back( handler );
+    numHandlers++;
     if ( !scheduled ) {
         schedule();
     }
@@ -49,17 +53,21 @@ bool Clock::registerHandler( Clock::HandlerBase* handler )
 
 bool Clock::unregisterHandler( Clock::HandlerBase* handler, bool& empty )
 {
-
-    StaticHandlerMap_t::iterator iter = staticHandlerMap.begin();
-
-    for ( ; iter != staticHandlerMap.end(); iter++ ) {
-        if ( *iter == handler ) {
-            staticHandlerMap.erase( iter );
-            break;
+    size_t slot = handler->clockSlot;
+    if ( slot >= staticHandlerMap.size() || staticHandlerMap[slot] != handler ) {
+        // The handler was last registered with another clock, so
+        // fall back to searching for it
+        for ( slot = 0; slot < staticHandlerMap.size(); slot++ ) {
+            if ( staticHandlerMap[slot] == handler ) break;
         }
     }
+
+    if ( slot < staticHandlerMap.size() ) {
+        staticHandlerMap[slot] = nullptr;
+        numHandlers--;
+    }
   
-    empty = staticHandlerMap.empty();
+    empty = ( numHandlers == 0 );
     
     return 0;
 }
@@ -72,10 +80,11 @@ Clock::getNextCycle()
 }
     
 void Clock::execute( void ) {
-    Simulation *sim = Simulation::getSimulation();
+    const SimulationContext& ctx = Simulation::getContext();
     
-    if ( staticHandlerMap.empty() ) {
+    if ( numHandlers == 0 ) {
         // std::cout << "Not rescheduling clock" << std::endl;
+        staticHandlerMap.clear();
         scheduled = false;
         return;
     } 
@@ -84,17 +93,37 @@ void Clock::execute( void ) {
     // currentCycle = period->convertFromCoreTime(sim->getCurrentSimCycle());
     currentCycle++;
     
-    StaticHandlerMap_t::iterator sop_iter,start_iter,stop_iter;
-    for ( sop_iter = staticHandlerMap.begin(); sop_iter != staticHandlerMap.end();  ) {
-        Clock::HandlerBase* handler = *sop_iter;
-        if ( (*handler)(currentCycle) ) sop_iter = staticHandlerMap.erase(sop_iter);
-        else ++sop_iter;
-        // (*handler)(currentCycle);
-        // ++sop_iter;
+    // Call the handlers, packing the ones that stay registered
+    // towards the front as we go.  Handlers registered during the
+    // tick are left for the next one.
+    size_t end = staticHandlerMap.size();
+    size_t pos = 0;
+    for ( size_t i = 0; i < end; i++ ) {
+        Clock::HandlerBase* handler = staticHandlerMap[i];
+        if ( handler == nullptr ) continue;
+        bool done = (*handler)(currentCycle);
+        // The handler may have been unregistered while it ran
+        if ( staticHandlerMap[i] == nullptr ) continue;
+        if ( done ) {
+            staticHandlerMap[i] = nullptr;
+            numHandlers--;
+            continue;
+        }
+        staticHandlerMap[i] = nullptr;
+        staticHandlerMap[pos] = handler;
+        handler->clockSlot = pos++;
+    }
+    for ( size_t i = end; i < staticHandlerMap.size(); i++ ) {
+        Clock::HandlerBase* handler = staticHandlerMap[i];
+        if ( handler == nullptr ) continue;
+        staticHandlerMap[pos] = handler;
+        handler->clockSlot = pos++;
     }
+    staticHandlerMap.resize(pos);
     
-    next = sim->getCurrentSimCycle() + period->getFactor();
-    sim->insertActivity( next, this );
+    next = *ctx.currentSimCycle + period->getFactor();
+    setDeliveryTime(next);
+    ctx.timeVortex->insert(this);
 
     return;
 }
@@ -102,8 +131,9 @@ void Clock::execute( void ) {
 void
 Clock::schedule()
 {
-    Simulation* sim = Simulation::getSimulation();
-    currentCycle = sim->getCurrentSimCycle() / period->getFactor();
+    const SimulationContext& ctx = Simulation::getContext();
+    SimTime_t now = *ctx.currentSimCycle;
+    currentCycle = now / period->getFactor();
     SimTime_t next = (currentCycle * period->getFactor()) + period->getFactor();
 
     // Check to see if we need to insert clock into queue at current
@@ -111,14 +141,15 @@ Clock::schedule()
     // tick and if the current priority is less than my priority.
     // However, if we are at time = 0, then we always go out to the
     // next cycle;
-    if ( sim->getCurrentPriority() < getPriority() && sim->getCurrentSimCycle() != 0 ) {
-        if ( sim->getCurrentSimCycle() % period->getFactor() == 0 ) {
-            next = sim->getCurrentSimCycle();
+    if ( *ctx.currentPriority < getPriority() && now != 0 ) {
+        if ( now % period->getFactor() == 0 ) {
+            next = now;
         }
     }
 
-    // std::cout << "Scheduling clock " << period->getFactor() << " at cycle " << next << " current cycle is " << sim->getCurrentSimCycle() << std::endl;
-    sim->insertActivity(next, this);
+    // std::cout << "Scheduling clock " << period->getFactor() << " at cycle " << next << " current cycle is " << now << std::endl;
+    setDeliveryTime(next);
+    ctx.timeVortex->insert(this);
     scheduled = true;
 }
 
@@ -128,7 +159,7 @@ Clock::print(const std::string& header, Output &out) const
     out.output("%s Clock Activity with period %" PRIu64 " to be delivered at %" PRIu64
                " with priority %d, with %d items on clock list\n",
                header.c_str(), period->getFactor(), getDeliveryTime(), getPriority(),
-               (int)staticHandlerMap.size());
+               (int)numHandlers);
 }
 
 } // namespace SST
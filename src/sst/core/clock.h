@@ -39,10 +39,17 @@ public:
 
     /** Functor classes for Clock handling */
     class HandlerBase {
+        friend class Clock;
     public:
+        HandlerBase() : clockSlot(0) {}
         /** Function called when Handler is invoked */
         virtual bool operator()(Cycle_t) = 0;
         virtual ~HandlerBase() {}
+
+    private:
+        /* Index in the handler list of the clock it was last
+         * registered with */
+        size_t clockSlot;
     };
 
 
@@ -118,6 +125,9 @@ public:
     
 private:
 /*     typedef std::list<Clock::HandlerBase*> HandlerMap_t; */
+    /* Handlers in the order they are called.  Removed handlers leave
+     * a nullptr behind, which execute() squeezes out while keeping
+     * the order of the rest. */
     typedef std::vector<Clock::HandlerBase*> StaticHandlerMap_t;
 
 
@@ -128,6 +138,8 @@ private:
     Cycle_t            currentCycle;
     TimeConverter*     period;
     StaticHandlerMap_t staticHandlerMap;
+    /* Number of handlers actually registered */
+    size_t             numHandlers;
     SimTime_t          next;
     bool               scheduled;
     
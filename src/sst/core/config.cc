@@ -55,8 +55,17 @@ Config::Config(RankInfo rankInfo)
     stopAfterSec = 0;
     timeBase    = "1 ps";
     heartbeatPeriod = "N";
+    checkpointPeriod = "0 ns";
+    checkpointPrefix = "checkpoint";
+    loadCheckpoint = "";
     partitioner = "sst.linear";
+    partitionMinLatency = "0 ns";
     timeVortex  = "sst.timevortex.priority_queue";
+    nearFutureWindow = "1 ns";
+    rankSync = "skip";
+    nonblocking_sync_reduce = false;
+    threadSync = "skip";
+    threadPinning = "none";
     dump_component_graph_file = "";
 
     char* wd_buf = (char*) malloc( sizeof(char) * PATH_MAX );
@@ -77,6 +86,7 @@ Config::Config(RankInfo rankInfo)
     output_core_prefix = "@x SST Core: ";
     print_timing = false;
     print_env = false;
+    parallel_load = false;
 
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     event_dump_file = "";
@@ -120,6 +130,8 @@ static const struct sstLongOpts_s sstOptions[] = {
     DEF_FLAGOPT("no-env-config",            0,      "disable SST environment configuration", &Config::disableEnvConfig),
     DEF_FLAGOPT("print-timing-info",        0,      "print SST timing information", &Config::enablePrintTiming),
     DEF_FLAGOPT("print-env",                0,      "print SST environment vairable", &Config::enablePrintEnv),
+    DEF_FLAGOPT("nonblocking-sync-reduce",  0,      "overlap the next rank sync time reduction with event processing (skip rank sync only)", &Config::enableNonblockingSyncReduce),
+    DEF_FLAGOPT("parallel-load",            0,      "run the model on every rank; each rank builds only the components it creates (see sst.getMyMPIRank()) and links crossing ranks are connected by name", &Config::enableParallelLoad),
     /* HiddenNoConfigDesc */
     DEF_ARGOPT("sdl-file",          "FILE",         "SST Configuration file", &Config::setConfigFile),
     DEF_ARGOPT("stopAtCycle",       "TIME",         "set time at which simulation will end execution", &Config::setStopAt),
@@ -131,14 +143,23 @@ static const struct sstLongOpts_s sstOptions[] = {
     DEF_ARGOPT("run-mode",          "MODE",         "run mode [ init | run | both]", &Config::setRunMode),
     DEF_ARGOPT("stop-at",           "TIME",         "set time at which simulation will end execution", &Config::setStopAt),
     DEF_ARGOPT("heartbeat-period",  "PERIOD",       "set time for heartbeats to be published (these are approximate timings, published by the core, to update on progress), default is every 10000 simulated seconds", &Config::setHeartbeat),
+    DEF_ARGOPT("checkpoint-period", "PERIOD",       "write a checkpoint at the first synchronization at or after every PERIOD of simulated time (default: 0, no checkpoints)", &Config::setCheckpointPeriod),
+    DEF_ARGOPT("checkpoint-prefix", "STR",          "name checkpoint files STR_N_RANK_THREAD.sstckpt, for the Nth checkpoint (default: checkpoint)", &Config::setCheckpointPrefix),
+    DEF_ARGOPT("load-checkpoint",   "STR",          "restart from the files STR_RANK_THREAD.sstckpt written by --checkpoint-period (e.g. checkpoint_2); run the same model with the same number of ranks and threads", &Config::setLoadCheckpoint),
     DEF_ARGOPT("timebase",          "TIMEBASE",     "sets the base time step of the simulation (default: 1ps)", &Config::setTimebase),
     DEF_ARGOPT("partitioner",       "PARTITIONER",  "select the partitioner to be used. <lib.partitionerName>", &Config::setPartitioner),
-    DEF_ARGOPT("timeVortex ",       "MODULE",       "select TimeVortex implementation <lib.timevortex>", &Config::setTimeVortex),
+    DEF_ARGOPT("partition-min-latency", "TIME",     "have the multilevel, simple and zoltan partitioners cut links with a latency below TIME only when balance needs it, raising the lookahead between ranks and threads (default: 0, off)", &Config::setPartitionMinLatency),
+    DEF_ARGOPT("timeVortex",        "MODULE",       "select TimeVortex implementation <lib.timevortex> (default: sst.timevortex.priority_queue, or sst.timevortex.ladder)", &Config::setTimeVortex),
+    DEF_ARGOPT("near-future-window","TIME",         "events delivered within this time of being sent bypass the TimeVortex, 0 to disable (default: 1ns)", &Config::setNearFutureWindow),
+    DEF_ARGOPT("rank-sync",         "MODE",         "rank synchronization [ skip | overlap ]; overlap syncs twice per minimum partition latency and overlaps the MPI exchange with event processing (default: skip)", &Config::setRankSync),
+    DEF_ARGOPT("thread-sync",       "MODE",         "thread synchronization [ skip | neighbor ]; neighbor replaces the global thread barriers with per-thread safe times that each thread only checks for the threads it has links from (default: skip)", &Config::setThreadSync),
+    DEF_ARGOPT("thread-pinning",    "MODE",         "bind threads to CPUs [ none | numa | core ]; numa binds each thread to the CPUs of one NUMA node and core to a single CPU, taken from the CPUs the rank may run on, neighboring threads sharing a node (default: none)", &Config::setThreadPinning),
     DEF_ARGOPT("output-directory",  "DIR",          "directory into which all SST output files should reside", &Config::setOutputDir),
     DEF_ARGOPT("output-config",     "FILE",         "file to write SST configuration (in Python format)", &Config::setWriteConfig),
     DEF_ARGOPT("output-dot",        "FILE",         "file to write SST configuration graph (in GraphViz format)", &Config::setWriteDot),
     DEF_ARGOPT("output-xml",        "FILE",         "file to write SST configuration graph (in XML format)", &Config::setWriteXML),
     DEF_ARGOPT("output-json",       "FILE",         "file to write SST configuration graph (in JSON format)", &Config::setWriteJSON),
+    DEF_ARGOPT("output-binary-config", "FILE",      "file to write the built and partitioned SST configuration graph (in binary format); run it again with sst FILE.sstbin", &Config::setWriteBinaryConfig),
     DEF_ARGOPT("output-partition",  "FILE",         "file to write SST component partitioning information", &Config::setWritePartition),
     DEF_ARGOPT("output-prefix-core","STR",          "set the SST::Output prefix for the core", &Config::setOutputPrefix),
 #ifdef USE_MEMPOOL
@@ -290,6 +311,11 @@ Config::parseCmdLine(int argc, char* argv[]) {
         return -1;
     }
 
+    if ( nonblocking_sync_reduce && rankSync != "skip" ) {
+        cout << "ERROR: --nonblocking-sync-reduce only applies to --rank-sync=skip" << endl;
+        return -1;
+    }
+
     // Ensure output directory ends with a directory separator
     if( output_directory.size() > 0 ) {
     if( '/' != output_directory[output_directory.size() - 1] ) {
@@ -314,6 +340,14 @@ Config::parseCmdLine(int argc, char* argv[]) {
     output_json.insert( 0, output_directory );
     }
 
+    if( output_binary.size() > 0 && isFileNameOnly(output_binary) ) {
+    output_binary.insert( 0, output_directory );
+    }
+
+    if( checkpointPrefix.size() > 0 && isFileNameOnly(checkpointPrefix) ) {
+    checkpointPrefix.insert( 0, output_directory );
+    }
+
     if( debugFile.size() > 0 && isFileNameOnly(debugFile) ) {
     debugFile.insert( 0, output_directory );
     }
@@ -326,11 +360,14 @@ bool Config::setConfigEntryFromModel(const string& entryName, const string& valu
 {
     for ( size_t i = 0 ; i < nLongOpts ; i++ ) {
         if ( !entryName.compare(sstOptions[i].opt.name) ) {
+            bool ok;
             if ( nullptr != sstOptions[i].argFunc ) {
-                return (this->*sstOptions[i].argFunc)(value);
+                ok = (this->*sstOptions[i].argFunc)(value);
             } else {
-                return (this->*sstOptions[i].flagFunc)();
+                ok = (this->*sstOptions[i].flagFunc)();
             }
+            if ( ok ) model_config_entries.emplace_back(entryName, value);
+            return ok;
         }
     }
     fprintf(stderr, "Unknown configuration entry [%s]\n", entryName.c_str());
@@ -436,6 +473,9 @@ bool Config::setStopAfter(const std::string& arg) {
 }
 /* TODO: Error checking */
 bool Config::setHeartbeat(const std::string& arg) { heartbeatPeriod = arg;  return true; }
+bool Config::setCheckpointPeriod(const std::string& arg) { checkpointPeriod = arg;  return true; }
+bool Config::setCheckpointPrefix(const std::string& arg) { checkpointPrefix = arg;  return true; }
+bool Config::setLoadCheckpoint(const std::string& arg) { loadCheckpoint = arg;  return true; }
 /* TODO: Error checking */
 bool Config::setTimebase(const std::string& arg) { timeBase = arg;  return true; }
 
@@ -448,16 +488,45 @@ bool Config::setPartitioner(const std::string& arg) {
     return true;
 }
 
+bool Config::setPartitionMinLatency(const std::string& arg) {
+    partitionMinLatency = arg;
+    return true;
+}
+
 bool Config::setTimeVortex(const std::string& arg) {
     timeVortex = arg;
     return true;
 }
 
+bool Config::setNearFutureWindow(const std::string& arg) {
+    nearFutureWindow = arg;
+    return true;
+}
+
+bool Config::setRankSync(const std::string& arg) {
+    if ( arg != "skip" && arg != "overlap" ) return false;
+    rankSync = arg;
+    return true;
+}
+
+bool Config::setThreadSync(const std::string& arg) {
+    if ( arg != "skip" && arg != "neighbor" ) return false;
+    threadSync = arg;
+    return true;
+}
+
+bool Config::setThreadPinning(const std::string& arg) {
+    if ( arg != "none" && arg != "numa" && arg != "core" ) return false;
+    threadPinning = arg;
+    return true;
+}
+
 bool Config::setOutputDir(const std::string& arg) { output_directory = arg ;  return true; }
 bool Config::setWriteConfig(const std::string& arg) { output_config_graph = arg;  return true; }
 bool Config::setWriteDot(const std::string& arg) { output_dot = arg; return true; }
 bool Config::setWriteXML(const std::string& arg){ output_xml = arg; return true; }
 bool Config::setWriteJSON(const std::string& arg) { output_json = arg; return true; }
+bool Config::setWriteBinaryConfig(const std::string& arg) { output_binary = arg; return true; }
 bool Config::setWritePartition(const std::string& arg) { dump_component_graph_file = arg; return true; }
 bool Config::setOutputPrefix(const std::string& arg) { output_core_prefix = arg; return true; }
 #ifdef USE_MEMPOOL
@@ -21,6 +21,8 @@
 #include "sst/core/serialization/serializable.h"
 
 #include <string>
+#include <utility>
+#include <vector>
 
 
 namespace SST {
@@ -58,17 +60,28 @@ public:
     std::string     stopAtCycle;        /*!< When to stop the simulation */
     uint32_t        stopAfterSec;       /*!< When (wall-time) to stop the simulation */
     std::string     heartbeatPeriod;    /*!< Sets the heartbeat period for the simulation */
+    std::string     checkpointPeriod;   /*!< Simulated time between checkpoints */
+    std::string     checkpointPrefix;   /*!< Prefix of the checkpoint file names */
+    std::string     loadCheckpoint;     /*!< Checkpoint to restart from */
     std::string     timeBase;           /*!< Timebase of simulation */
     std::string     partitioner;        /*!< Partitioner to use */
+    std::string     partitionMinLatency; /*!< Partitioners avoid cutting links with a lower latency */
     std::string     timeVortex;         /*!< TimeVortex implementation to use */
+    std::string     nearFutureWindow;   /*!< Window for the near-future event queue */
+    std::string     rankSync;           /*!< Rank synchronization scheme (skip, overlap) */
+    bool            nonblocking_sync_reduce; /*!< Use a non-blocking reduction for the next rank sync time */
+    std::string     threadSync;         /*!< Thread synchronization scheme (skip, neighbor) */
+    std::string     threadPinning;      /*!< CPUs the threads are bound to (none, numa, core) */
     std::string     output_config_graph;  /*!< File to dump configuration graph */
     std::string     output_dot;         /*!< File to dump dot output */
     std::string     output_xml;         /*!< File to dump XML output */
     std::string     output_json;        /*!< File to dump JSON output */
+    std::string     output_binary;      /*!< File to dump binary configuration graph */
     std::string     output_directory;   /*!< Output directory to dump all files to */
     std::string     model_options;      /*!< Options to pass to Python Model generator */
     std::string     dump_component_graph_file; /*!< File to dump component graph */
     std::string     output_core_prefix;  /*!< Set the SST::Output prefix for the core */
+    std::vector<std::pair<std::string, std::string>> model_config_entries; /*!< Entries set by the model, stored in binary configuration graphs */
 
     RankInfo        world_size;         /*!< Number of ranks, threads which should be invoked per rank */
     uint32_t        verbose;            /*!< Verbosity */
@@ -76,6 +89,7 @@ public:
     bool            enable_sig_handling; /*!< Enable signal handling */
     bool            print_timing;       /*!< Print SST timing information */
     bool            print_env;          /*!< Print SST environment */
+    bool            parallel_load;      /*!< Every rank runs the model and builds only its own part of the graph */
 
 #ifdef USE_MEMPOOL
     std::string     event_dump_file;    /*!< File to dump undeleted events to */
@@ -93,6 +107,8 @@ public:
     bool disableEnvConfig()     { no_env_config = true; return true;}
     bool enablePrintTiming()    { print_timing = true; return true;}
     bool enablePrintEnv()       { print_env = true; return true; }
+    bool enableNonblockingSyncReduce() { nonblocking_sync_reduce = true; return true; }
+    bool enableParallelLoad()   { parallel_load = true; return true; }
 
     bool setConfigFile(const std::string& arg);
     bool setDebugFile(const std::string& arg);
@@ -102,14 +118,23 @@ public:
     bool setStopAt(const std::string& arg);
     bool setStopAfter(const std::string& arg);
     bool setHeartbeat(const std::string& arg);
+    bool setCheckpointPeriod(const std::string& arg);
+    bool setCheckpointPrefix(const std::string& arg);
+    bool setLoadCheckpoint(const std::string& arg);
     bool setTimebase(const std::string& arg);
     bool setPartitioner(const std::string& arg);
+    bool setPartitionMinLatency(const std::string& arg);
     bool setTimeVortex(const std::string& arg);
+    bool setNearFutureWindow(const std::string& arg);
+    bool setRankSync(const std::string& arg);
+    bool setThreadSync(const std::string& arg);
+    bool setThreadPinning(const std::string& arg);
     bool setOutputDir(const std::string& arg);
     bool setWriteConfig(const std::string& arg);
     bool setWriteDot(const std::string& arg);
     bool setWriteXML(const std::string& arg);
     bool setWriteJSON(const std::string& arg);
+    bool setWriteBinaryConfig(const std::string& arg);
     bool setWritePartition(const std::string& arg);
     bool setOutputPrefix(const std::string& arg);
 #ifdef USE_MEMPOOL
@@ -129,18 +154,25 @@ public:
         std::cout << "configFile = " << configFile << std::endl;
         std::cout << "stopAtCycle = " << stopAtCycle << std::endl;
         std::cout << "stopAfterSec = " << stopAfterSec << std::endl;
+        std::cout << "checkpointPeriod = " << checkpointPeriod << std::endl;
+        std::cout << "checkpointPrefix = " << checkpointPrefix << std::endl;
+        std::cout << "loadCheckpoint = " << loadCheckpoint << std::endl;
         std::cout << "timeBase = " << timeBase << std::endl;
         std::cout << "partitioner = " << partitioner << std::endl;
+        std::cout << "partitionMinLatency = " << partitionMinLatency << std::endl;
         std::cout << "output_config_graph = " << output_config_graph << std::endl;
         std::cout << "output_xml = " << output_xml << std::endl;
         std::cout << "no_env_config = " << no_env_config << std::endl;
         std::cout << "output_directory = " << output_directory << std::endl;
         std::cout << "output_json = " << output_json << std::endl;
+        std::cout << "output_binary = " << output_binary << std::endl;
         std::cout << "model_options = " << model_options << std::endl;
         std::cout << "num_threads = " << world_size.thread << std::endl;
+        std::cout << "threadPinning = " << threadPinning << std::endl;
         std::cout << "enable_sig_handling = " << enable_sig_handling << std::endl;
         std::cout << "output_core_prefix = " << output_core_prefix << std::endl;
         std::cout << "print_timing=" << print_timing << std::endl;
+        std::cout << "parallel_load = " << parallel_load << std::endl;
     std::cout << "print_env" << print_env << std::endl;
     }
 
@@ -165,18 +197,30 @@ public:
         ser & configFile;
         ser & stopAtCycle;
         ser & stopAfterSec;
+        ser & checkpointPeriod;
+        ser & checkpointPrefix;
+        ser & loadCheckpoint;
         ser & timeBase;
         ser & partitioner;
+        ser & partitionMinLatency;
+        ser & timeVortex;
+        ser & nearFutureWindow;
+        ser & rankSync;
+        ser & nonblocking_sync_reduce;
+        ser & threadSync;
+        ser & threadPinning;
         ser & dump_component_graph_file;
         ser & output_config_graph;
         ser & output_xml;
         ser & output_json;
+        ser & output_binary;
         ser & no_env_config;
         ser & model_options;
         ser & world_size;
         ser & enable_sig_handling;
         ser & output_core_prefix;
         ser & print_timing;
+        ser & parallel_load;
     }
 
 private:
@@ -15,6 +15,7 @@
 
 #include <fstream>
 #include <algorithm>
+#include <iterator>
 
 #include "sst/core/component.h"
 #include "sst/core/config.h"
@@ -362,6 +363,75 @@ ConfigGraph::checkRanks(RankInfo ranks)
     return true;
 }
 
+void
+ConfigGraph::setLocalComponentRanks(RankInfo myRank, RankInfo world_size)
+{
+    size_t unplaced = 0;
+    for ( ConfigComponent& comp : comps ) {
+        if ( !comp.rank.isAssigned() ) {
+            unplaced++;
+        }
+        else if ( comp.rank.rank != myRank.rank ) {
+            Output::getDefaultObject().fatal(CALL_INFO, 1,
+                    "Component %s was placed on rank %u, but was built by rank %u.  With a parallel "
+                    "load components stay on the rank that builds them.\n",
+                    comp.name.c_str(), comp.rank.rank, myRank.rank);
+        }
+    }
+
+    // Contiguous blocks, so neighbours built together share a thread
+    size_t index = 0;
+    for ( ConfigComponent& comp : comps ) {
+        if ( comp.rank.isAssigned() ) continue;
+        comp.setRank(RankInfo(myRank.rank, (index * world_size.thread) / unplaced));
+        index++;
+    }
+}
+
+void
+ConfigGraph::extractBoundaryLinks(std::vector<ConfigLink>& boundary)
+{
+    auto dangling = [](const ConfigLink& link) { return link.current_ref < 2; };
+
+    for ( ConfigLink& link : links ) {
+        if ( !dangling(link) ) continue;
+
+        std::vector<LinkId_t>& compLinks = findComponent(link.component[0])->links;
+        compLinks.erase(std::remove(compLinks.begin(), compLinks.end(), link.id), compLinks.end());
+        link_names.erase(link.name);
+        boundary.push_back(link);
+    }
+    links.data.erase(std::remove_if(links.data.begin(), links.data.end(), dangling), links.data.end());
+}
+
+void
+ConfigGraph::addBoundaryLinks(std::vector<ConfigLink>& boundary, std::vector<ConfigComponent>& remotes)
+{
+    // Merge in one pass; inserting into a SparseVectorMap one at a time
+    // is quadratic
+    auto byId = [](const ConfigComponent& a, const ConfigComponent& b) { return a.id < b.id; };
+    std::sort(remotes.begin(), remotes.end(), byId);
+    remotes.erase(std::unique(remotes.begin(), remotes.end(),
+                    [](const ConfigComponent& a, const ConfigComponent& b) { return a.id == b.id; }),
+            remotes.end());
+
+    std::vector<ConfigComponent> merged;
+    merged.reserve(comps.data.size() + remotes.size());
+    std::merge(std::make_move_iterator(comps.data.begin()), std::make_move_iterator(comps.data.end()),
+            std::make_move_iterator(remotes.begin()), std::make_move_iterator(remotes.end()),
+            std::back_inserter(merged), byId);
+    comps.data.swap(merged);
+
+    std::sort(boundary.begin(), boundary.end(),
+            [](const ConfigLink& a, const ConfigLink& b) { return a.id < b.id; });
+    for ( ConfigLink& link : boundary ) {
+        links.push_back(link);
+        for ( int i = 0; i < 2; i++ ) {
+            findComponent(link.component[i])->links.push_back(link.id);
+        }
+    }
+}
+
 void
 ConfigGraph::postCreationCleanup()
 {
@@ -41,6 +41,10 @@ class Config;
 class TimeLord;
 class ConfigGraph;
 
+/** With a parallel load, each rank's model numbers its components
+ * starting at rank << PARALLEL_LOAD_ID_BITS */
+#define PARALLEL_LOAD_ID_BITS 32
+
 typedef SparseVectorMap<ComponentId_t> ComponentIdMap_t;
 typedef std::vector<LinkId_t> LinkIdMap_t;
 
@@ -87,8 +91,11 @@ public:
         ser & component[1];
         ser & port[0];
         ser & port[1];
+        ser & latency_str[0];
+        ser & latency_str[1];
         ser & latency[0];
         ser & latency[1];
+        ser & no_cut;
         ser & current_ref;
     }
 
@@ -319,6 +326,9 @@ public:
     bool containsComponentInRank(RankInfo rank);
     /** Verify that all components have valid Ranks assigned */
     bool checkRanks(RankInfo ranks);
+    /** Place the components built by this rank's part of a parallel
+     * load, spreading those the model did not place over the threads */
+    void setLocalComponentRanks(RankInfo myRank, RankInfo world_size);
 
 
     // API for programmatic initialization
@@ -358,6 +368,14 @@ public:
     /** Set a Link to be no-cut */
     void setLinkNoCut(const std::string& link_name);
 
+    /** Remove the links that only have one end in this graph, with the
+     * connected end in slot 0.  Used by parallel loads, where the other
+     * end is on another rank. */
+    void extractBoundaryLinks(std::vector<ConfigLink>& boundary);
+    /** Add links that cross to another rank, along with copies (without
+     * links or params) of the remote components they connect to */
+    void addBoundaryLinks(std::vector<ConfigLink>& boundary, std::vector<ConfigComponent>& remotes);
+
     /** Perform any post-creation cleanup processes */
     void postCreationCleanup();
 
@@ -54,6 +54,36 @@ void NullEvent::execute(void)
 #ifdef USE_MEMPOOL
 std::mutex Activity::poolMutex;
 std::vector<Activity::PoolInfo_t> Activity::memPools;
+constexpr size_t Activity::poolClassSize;
+constexpr size_t Activity::numPoolClasses;
+thread_local Core::MemPool* Activity::threadPools[Activity::numPoolClasses];
+
+Core::MemPool* Activity::findPool(size_t sizeClass)
+{
+    // Size classes beyond the lookup table are rare, so a short
+    // per-thread list is enough for them
+    static thread_local std::vector<PoolInfo_t> largePools;
+
+    size_t size = sizeClass * poolClassSize;
+    if ( sizeClass >= numPoolClasses ) {
+        for ( auto& p : largePools ) {
+            if ( p.size == size ) return p.pool;
+        }
+    }
+
+    Core::MemPool* pool = new Core::MemPool(size+sizeof(PoolData_t));
+    std::thread::id tid = std::this_thread::get_id();
+    if ( sizeClass < numPoolClasses ) {
+        threadPools[sizeClass] = pool;
+    }
+    else {
+        largePools.emplace_back(tid, size, pool);
+    }
+
+    std::lock_guard<std::mutex> lock(poolMutex);
+    memPools.emplace_back(tid, size, pool);
+    return pool;
+}
 #endif
 
 
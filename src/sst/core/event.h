@@ -17,6 +17,7 @@
 #include <atomic>
 #include <string>
 #include <cinttypes>
+#include <type_traits>
 
 #include "sst/core/activity.h"
 
@@ -81,6 +82,21 @@ public:
 #endif
     }
 
+    /** Returns true if this event uses the fixed-layout wire format
+     * (see ImplementTriviallySerializable) and sets data and size to
+     * describe its data.  For use by SST Core only */
+    virtual bool getTrivialData(void*& UNUSED(data), size_t& UNUSED(size)) {
+        return false;
+    }
+
+    /** Restores the fields that the fixed-layout wire format sends
+     * ahead of the event's data.  For use by SST Core only */
+    inline void setTrivialHeader(SimTime_t time, LinkId_t id, int prio) {
+        setDeliveryTime(time);
+        setDeliveryLink(id, nullptr);
+        setPriority(prio);
+    }
+
 
     /// Functor classes for Event handling
     class HandlerBase {
@@ -226,6 +242,27 @@ private:
 };
 
 
+/**
+ * Opts an Event into the fixed-layout wire format used to exchange
+ * events between ranks.  All of the event's own data must be held in
+ * the single trivially copyable member named here, which is copied
+ * with memcpy instead of going through serialize_order().  The event
+ * must still use ImplementSerializable, which is used to construct it
+ * on the receiving rank and for all other serialization.  Classes
+ * derived from such an event must use the macro again if they add
+ * data.
+ */
+#define ImplementTriviallySerializable(member)                          \
+ public:                                                                \
+  bool getTrivialData(void*& data, size_t& size) override {            \
+    static_assert(std::is_trivially_copyable<decltype(member)>::value, \
+                  #member " must be trivially copyable");               \
+    data = &member;                                                     \
+    size = sizeof(member);                                              \
+    return true;                                                        \
+  }
+
+
 /**
  * Null Event.  Does nothing.
  */
@@ -241,6 +278,13 @@ public:
                 header.c_str(), getDeliveryTime(), getPriority());
     }
 
+    /** NullEvents have no data of their own */
+    bool getTrivialData(void*& data, size_t& size) override {
+        data = nullptr;
+        size = 0;
+        return true;
+    }
+
     
 
 private:
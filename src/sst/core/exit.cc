@@ -34,6 +34,7 @@ Exit::Exit( int num_threads, TimeConverter* period, bool single_rank ) :
 //     m_functor( new EventHandler<Exit,bool,Event*> (this,&Exit::handler ) ),
     num_threads(num_threads),
     m_refCount( 0 ),
+    global_count( 1 ),
     m_period( period ),
     end_time(0),
     single_rank(single_rank)
@@ -133,6 +134,12 @@ unsigned int Exit::getRefCount() {
     return m_refCount;
 }
 
+bool Exit::isDone(SimTime_t& end) {
+    std::lock_guard<Spinlock> lock(slock);
+    end = end_time;
+    return m_refCount == 0;
+}
+
 
 void
 Exit::execute()
@@ -56,6 +56,10 @@ public:
     bool refDec( ComponentId_t, uint32_t thread );
 
     unsigned int getRefCount();
+    /** True once every reference is gone, with end set to the end
+     * time.  Both are read under the lock, so a reference dropped on
+     * another thread is never seen without its end time. */
+    bool isDone(SimTime_t& end);
     SimTime_t getEndTime() { return end_time; }
     
     void execute(void) override;
@@ -70,6 +74,16 @@ public:
         return global_count;
     }
 
+    /** Take the result of a reduction done in place of check():
+     * count is nonzero while any rank still has references and end
+     * is the latest end time of all ranks.  The local end time is
+     * kept until every rank is done, since the next reduction needs
+     * it. */
+    void setGlobalStatus(unsigned int count, SimTime_t end) {
+        global_count = count;
+        if ( count == 0 ) end_time = end;
+    }
+
 private:
     Exit() { } // for serialization only
     Exit(const Exit&);           // Don't implement
@@ -34,6 +34,7 @@
 #include "sst/core/statapi/statoutputtxt.h"
 #include "sst/core/statapi/statoutputcsv.h"
 #include "sst/core/statapi/statoutputjson.h"
+#include "sst/core/statapi/statoutputbinary.h"
 #ifdef HAVE_HDF5
 #include "sst/core/statapi/statoutputhdf5.h"
 #endif
@@ -41,7 +42,9 @@
 #include "sst/core/statapi/stataccumulator.h"
 #include "sst/core/statapi/stathistogram.h"
 #include "sst/core/statapi/statnull.h"
+#include "sst/core/statapi/statpercentile.h"
 #include "sst/core/statapi/statuniquecount.h"
+#include "sst/core/statapi/statuniquecountapprox.h"
 
 using namespace SST::Statistics;
 
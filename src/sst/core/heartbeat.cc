@@ -31,7 +31,7 @@ SimulatorHeartbeat::SimulatorHeartbeat( Config* UNUSED(cfg), int this_rank, Simu
     rank(this_rank),
     m_period( period )
 {
-    sim->insertActivity( period->getFactor(), this );
+    sim->insertActivity( sim->getCurrentSimCycle() + period->getFactor(), this );
     if( (0 == this_rank) ) {
         lastTime = sst_get_cpu_time();
     }
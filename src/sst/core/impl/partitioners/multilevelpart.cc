@@ -0,0 +1,595 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "sst/core/impl/partitioners/multilevelpart.h"
+
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <thread>
+#include <unordered_map>
+
+#include "sst/core/output.h"
+#include "sst/core/configGraph.h"
+
+using namespace SST::IMPL::Partition;
+
+typedef SSTMultilevelPartition::Graph Graph;
+
+namespace {
+
+/* Coarsening stops once a graph has this few vertices */
+const size_t COARSEN_TO = 64;
+/* How far a side may go over its share of the weight */
+const double IMBALANCE = 0.03;
+/* Bisections grown on the coarsest graph, the best one is kept */
+const int INITIAL_TRIES = 8;
+/* Most refinement passes at each level */
+const int REFINE_PASSES = 8;
+
+const uint32_t UNMATCHED = UINT32_MAX;
+
+double totalWeight(const Graph& g)
+{
+    return std::accumulate(g.vwgt.begin(), g.vwgt.end(), 0.0);
+}
+
+int64_t cutWeight(const Graph& g, const std::vector<uint8_t>& side)
+{
+    int64_t cut = 0;
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        for ( uint32_t e = g.xadj[v]; e < g.xadj[v+1]; e++ ) {
+            if ( side[g.adjncy[e]] != side[v] ) cut += g.adjwgt[e];
+        }
+    }
+    return cut / 2;
+}
+
+/* Weight over the maximums of the two sides */
+double excessWeight(const double weight[2], const double maxWeight[2])
+{
+    return std::max(0.0, weight[0] - maxWeight[0]) + std::max(0.0, weight[1] - maxWeight[1]);
+}
+
+double excessWeight(const Graph& g, const std::vector<uint8_t>& side, const double maxWeight[2])
+{
+    double weight[2] = { 0, 0 };
+    for ( uint32_t v = 0; v < g.size(); v++ ) weight[side[v]] += g.vwgt[v];
+    return excessWeight(weight, maxWeight);
+}
+
+/* Collapse the vertices of g into cn coarse vertices, cmap giving the
+ * coarse vertex of each, summing the weights of edges that end up
+ * between the same coarse vertices */
+Graph contract(const Graph& g, const std::vector<uint32_t>& cmap, size_t cn)
+{
+    size_t n = g.size();
+    std::vector<uint32_t> start(cn + 1, 0);
+    for ( uint32_t v = 0; v < n; v++ ) start[cmap[v] + 1]++;
+    for ( size_t cv = 0; cv < cn; cv++ ) start[cv + 1] += start[cv];
+    std::vector<uint32_t> members(n);
+    std::vector<uint32_t> fill(start.begin(), start.end() - 1);
+    for ( uint32_t v = 0; v < n; v++ ) members[fill[cmap[v]]++] = v;
+
+    Graph c;
+    c.vwgt.assign(cn, 0);
+    c.xadj.reserve(cn + 1);
+    c.xadj.push_back(0);
+    std::vector<int64_t> slot(cn, -1);
+    for ( uint32_t cv = 0; cv < cn; cv++ ) {
+        size_t first = c.adjncy.size();
+        for ( uint32_t i = start[cv]; i < start[cv + 1]; i++ ) {
+            uint32_t v = members[i];
+            c.vwgt[cv] += g.vwgt[v];
+            for ( uint32_t e = g.xadj[v]; e < g.xadj[v+1]; e++ ) {
+                uint32_t cu = cmap[g.adjncy[e]];
+                if ( cu == cv ) continue;
+                if ( slot[cu] < 0 ) {
+                    slot[cu] = c.adjncy.size();
+                    c.adjncy.push_back(cu);
+                    c.adjwgt.push_back(g.adjwgt[e]);
+                }
+                else {
+                    c.adjwgt[slot[cu]] += g.adjwgt[e];
+                }
+            }
+        }
+        for ( size_t e = first; e < c.adjncy.size(); e++ ) slot[c.adjncy[e]] = -1;
+        c.xadj.push_back(c.adjncy.size());
+    }
+    return c;
+}
+
+/* Pair each vertex with the unmatched neighbor it has the heaviest edge
+ * to, visiting the vertices in random order, and collapse the pairs.
+ * cmap gets the coarse vertex of each vertex. */
+Graph coarsen(const Graph& g, std::vector<uint32_t>& cmap, std::mt19937& rng, double maxVertexWeight)
+{
+    size_t n = g.size();
+    std::vector<uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    std::vector<uint32_t> match(n, UNMATCHED);
+    uint32_t cn = 0;
+    cmap.assign(n, 0);
+    for ( uint32_t v : order ) {
+        if ( match[v] != UNMATCHED ) continue;
+        uint32_t mate = v;
+        int64_t heaviest = 0;
+        for ( uint32_t e = g.xadj[v]; e < g.xadj[v+1]; e++ ) {
+            uint32_t u = g.adjncy[e];
+            if ( match[u] == UNMATCHED && g.adjwgt[e] > heaviest && g.vwgt[v] + g.vwgt[u] <= maxVertexWeight ) {
+                mate = u;
+                heaviest = g.adjwgt[e];
+            }
+        }
+        match[v] = mate;
+        match[mate] = v;
+        cmap[v] = cmap[mate] = cn++;
+    }
+    return contract(g, cmap, cn);
+}
+
+/* Collapse the groups of vertices joined by edges weighing at least
+ * bond, as long as a group stays under maxGroupWeight, so that no
+ * later level can cut them apart */
+Graph joinBonded(const Graph& g, std::vector<uint32_t>& cmap, int64_t bond, double maxGroupWeight)
+{
+    size_t n = g.size();
+    std::vector<uint32_t> root(n);
+    std::iota(root.begin(), root.end(), 0);
+    std::vector<double> weight(g.vwgt);
+    auto find = [&root](uint32_t v) {
+        while ( root[v] != v ) v = root[v] = root[root[v]];
+        return v;
+    };
+    for ( uint32_t v = 0; v < n; v++ ) {
+        for ( uint32_t e = g.xadj[v]; e < g.xadj[v+1]; e++ ) {
+            if ( g.adjwgt[e] < bond ) continue;
+            uint32_t a = find(v);
+            uint32_t b = find(g.adjncy[e]);
+            if ( a == b || weight[a] + weight[b] > maxGroupWeight ) continue;
+            root[b] = a;
+            weight[a] += weight[b];
+        }
+    }
+
+    uint32_t cn = 0;
+    cmap.assign(n, UNMATCHED);
+    for ( uint32_t v = 0; v < n; v++ ) {
+        uint32_t r = find(v);
+        if ( cmap[r] == UNMATCHED ) cmap[r] = cn++;
+        cmap[v] = cmap[r];
+    }
+    return contract(g, cmap, cn);
+}
+
+/* Grow side 0 breadth first from a random vertex until it holds about
+ * target weight, starting again elsewhere when a connected component
+ * runs out */
+void grow(const Graph& g, std::vector<uint8_t>& side, double target, std::mt19937& rng)
+{
+    size_t n = g.size();
+    side.assign(n, 1);
+    if ( n == 0 ) return;
+
+    std::vector<uint8_t> queued(n, 0);
+    std::deque<uint32_t> frontier;
+    uint32_t next = std::uniform_int_distribution<uint32_t>(0, n - 1)(rng);
+    size_t scanned = 0;
+    double weight = 0;
+    while ( weight < target ) {
+        if ( frontier.empty() ) {
+            while ( scanned < n && queued[next] ) {
+                next = ( next + 1 ) % n;
+                scanned++;
+            }
+            if ( scanned == n ) break;
+            queued[next] = 1;
+            frontier.push_back(next);
+        }
+        uint32_t v = frontier.front();
+        frontier.pop_front();
+        // Leave out vertices that would overshoot by more than they
+        // make up
+        if ( weight + g.vwgt[v] - target > target - weight ) continue;
+        side[v] = 0;
+        weight += g.vwgt[v];
+        for ( uint32_t e = g.xadj[v]; e < g.xadj[v+1]; e++ ) {
+            uint32_t u = g.adjncy[e];
+            if ( !queued[u] ) {
+                queued[u] = 1;
+                frontier.push_back(u);
+            }
+        }
+    }
+}
+
+/* Fiduccia-Mattheyses refinement.  Each pass moves the vertex with the
+ * highest gain whose move keeps the sides under their maximum weights,
+ * or shrinks the weight over them, and locks it.  The pass stops after
+ * a run of moves without improvement and rolls back to the best point
+ * seen, ranking less excess weight ahead of a smaller cut.  The heaps
+ * are not updated in place, so stale entries are skipped when they
+ * come to the top. */
+void refine(const Graph& g, std::vector<uint8_t>& side, const double maxWeight[2])
+{
+    typedef std::pair<int64_t, uint32_t> Entry;
+
+    size_t n = g.size();
+    if ( n < 2 ) return;
+    const size_t stall = std::max<size_t>(50, n / 20);
+    std::vector<int64_t> gain(n);
+    std::vector<uint8_t> locked(n);
+    std::vector<uint32_t> moves;
+
+    for ( int pass = 0; pass < REFINE_PASSES; pass++ ) {
+        double weight[2] = { 0, 0 };
+        int64_t cut = 0;
+        for ( uint32_t v = 0; v < n; v++ ) {
+            weight[side[v]] += g.vwgt[v];
+            gain[v] = 0;
+            for ( uint32_t e = g.xadj[v]; e < g.xadj[v+1]; e++ ) {
+                if ( side[g.adjncy[e]] != side[v] ) {
+                    gain[v] += g.adjwgt[e];
+                    cut += g.adjwgt[e];
+                }
+                else {
+                    gain[v] -= g.adjwgt[e];
+                }
+            }
+        }
+        cut /= 2;
+
+        std::priority_queue<Entry> heap[2];
+        for ( uint32_t v = 0; v < n; v++ ) heap[side[v]].emplace(gain[v], v);
+        std::fill(locked.begin(), locked.end(), 0);
+        moves.clear();
+
+        double bestExcess = excessWeight(weight, maxWeight);
+        int64_t bestCut = cut;
+        size_t bestMoves = 0;
+        while ( moves.size() - bestMoves < stall ) {
+            int from = -1;
+            for ( int s = 0; s < 2; s++ ) {
+                while ( !heap[s].empty() ) {
+                    const Entry& top = heap[s].top();
+                    if ( locked[top.second] || side[top.second] != s || gain[top.second] != top.first ) {
+                        heap[s].pop();
+                        continue;
+                    }
+                    break;
+                }
+                if ( heap[s].empty() ) continue;
+
+                uint32_t v = heap[s].top().second;
+                double moved[2] = { weight[0], weight[1] };
+                moved[s] -= g.vwgt[v];
+                moved[1-s] += g.vwgt[v];
+                if ( moved[1-s] > maxWeight[1-s] &&
+                     excessWeight(moved, maxWeight) >= excessWeight(weight, maxWeight) ) continue;
+
+                // Prefer the higher gain, then moving off the heavier side
+                if ( from < 0 || gain[v] > gain[heap[from].top().second] ||
+                     ( gain[v] == gain[heap[from].top().second] && weight[s] > weight[from] ) ) {
+                    from = s;
+                }
+            }
+            if ( from < 0 ) break;
+
+            uint32_t v = heap[from].top().second;
+            heap[from].pop();
+            int to = 1 - from;
+            side[v] = to;
+            weight[from] -= g.vwgt[v];
+            weight[to] += g.vwgt[v];
+            cut -= gain[v];
+            gain[v] = -gain[v];
+            locked[v] = 1;
+            moves.push_back(v);
+            for ( uint32_t e = g.xadj[v]; e < g.xadj[v+1]; e++ ) {
+                uint32_t u = g.adjncy[e];
+                if ( locked[u] ) continue;
+                gain[u] += ( side[u] == to ) ? -2 * g.adjwgt[e] : 2 * g.adjwgt[e];
+                heap[side[u]].emplace(gain[u], u);
+            }
+
+            double excess = excessWeight(weight, maxWeight);
+            if ( excess < bestExcess || ( excess == bestExcess && cut < bestCut ) ) {
+                bestExcess = excess;
+                bestCut = cut;
+                bestMoves = moves.size();
+            }
+        }
+
+        for ( size_t i = moves.size(); i > bestMoves; i-- ) {
+            side[moves[i-1]] ^= 1;
+        }
+        if ( bestMoves == 0 ) break;
+    }
+}
+
+/* Split g into two sides, side 0 getting fraction0 of the weight.
+ * Edges weighing at least bond are only cut when balance needs it. */
+std::vector<uint8_t> bisect(const Graph& g, double fraction0, std::mt19937& rng, int64_t bond)
+{
+    double total = totalWeight(g);
+    double maxWeight[2] = { total * fraction0 * ( 1 + IMBALANCE ), total * ( 1 - fraction0 ) * ( 1 + IMBALANCE ) };
+
+    // A deque keeps references to the levels valid as it grows
+    std::deque<Graph> levels;
+    std::vector<std::vector<uint32_t> > cmaps;
+    const Graph* coarsest = &g;
+    const double maxVertexWeight = 1.5 * total / COARSEN_TO;
+    if ( bond != INT64_MAX ) {
+        std::vector<uint32_t> cmap;
+        Graph c = joinBonded(g, cmap, bond, std::min(fraction0, 1 - fraction0) * total / 2);
+        if ( c.size() < g.size() ) {
+            cmaps.push_back(std::move(cmap));
+            levels.push_back(std::move(c));
+            coarsest = &levels.back();
+        }
+    }
+    while ( coarsest->size() > COARSEN_TO ) {
+        std::vector<uint32_t> cmap;
+        Graph c = coarsen(*coarsest, cmap, rng, maxVertexWeight);
+        // Stop when few vertices could still be matched
+        if ( c.size() > coarsest->size() * 0.95 ) break;
+        cmaps.push_back(std::move(cmap));
+        levels.push_back(std::move(c));
+        coarsest = &levels.back();
+    }
+
+    std::vector<uint8_t> side;
+    double bestExcess = 0;
+    int64_t bestCut = 0;
+    for ( int i = 0; i < INITIAL_TRIES; i++ ) {
+        std::vector<uint8_t> trial;
+        grow(*coarsest, trial, total * fraction0, rng);
+        refine(*coarsest, trial, maxWeight);
+        double excess = excessWeight(*coarsest, trial, maxWeight);
+        int64_t cut = cutWeight(*coarsest, trial);
+        if ( side.empty() || excess < bestExcess || ( excess == bestExcess && cut < bestCut ) ) {
+            side.swap(trial);
+            bestExcess = excess;
+            bestCut = cut;
+        }
+    }
+
+    // Project the bisection back one level at a time, refining it at
+    // each level
+    for ( size_t level = cmaps.size(); level > 0; level-- ) {
+        const Graph& fine = ( level == 1 ) ? g : levels[level - 2];
+        const std::vector<uint32_t>& cmap = cmaps[level - 1];
+        std::vector<uint8_t> fineSide(fine.size());
+        for ( uint32_t v = 0; v < fine.size(); v++ ) fineSide[v] = side[cmap[v]];
+        refine(fine, fineSide, maxWeight);
+        side.swap(fineSide);
+    }
+    return side;
+}
+
+/* Graph induced by the vertices on one side.  ids gets the ids of its
+ * vertices in the whole graph. */
+Graph subgraph(const Graph& g, const std::vector<uint8_t>& side, uint8_t which,
+               const std::vector<uint32_t>& gids, std::vector<uint32_t>& ids)
+{
+    std::vector<uint32_t> index(g.size(), UNMATCHED);
+    Graph s;
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        if ( side[v] != which ) continue;
+        index[v] = s.vwgt.size();
+        s.vwgt.push_back(g.vwgt[v]);
+        ids.push_back(gids[v]);
+    }
+    s.xadj.reserve(s.vwgt.size() + 1);
+    s.xadj.push_back(0);
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        if ( side[v] != which ) continue;
+        for ( uint32_t e = g.xadj[v]; e < g.xadj[v+1]; e++ ) {
+            uint32_t u = index[g.adjncy[e]];
+            if ( u == UNMATCHED ) continue;
+            s.adjncy.push_back(u);
+            s.adjwgt.push_back(g.adjwgt[e]);
+        }
+        s.xadj.push_back(s.adjncy.size());
+    }
+    return s;
+}
+
+/* Graphs induced by the vertices of each of numParts parts in one
+ * pass.  ids[p] gets the ids of the vertices of part p. */
+std::vector<Graph> splitParts(const Graph& g, const std::vector<uint32_t>& part, uint32_t numParts,
+                              std::vector<std::vector<uint32_t> >& ids)
+{
+    std::vector<Graph> subs(numParts);
+    ids.assign(numParts, std::vector<uint32_t>());
+    std::vector<uint32_t> index(g.size());
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        Graph& s = subs[part[v]];
+        index[v] = s.vwgt.size();
+        s.vwgt.push_back(g.vwgt[v]);
+        ids[part[v]].push_back(v);
+    }
+    for ( Graph& s : subs ) s.xadj.push_back(0);
+    for ( uint32_t v = 0; v < g.size(); v++ ) {
+        Graph& s = subs[part[v]];
+        for ( uint32_t e = g.xadj[v]; e < g.xadj[v+1]; e++ ) {
+            uint32_t u = g.adjncy[e];
+            if ( part[u] != part[v] ) continue;
+            s.adjncy.push_back(index[u]);
+            s.adjwgt.push_back(g.adjwgt[e]);
+        }
+        s.xadj.push_back(s.adjncy.size());
+    }
+    return subs;
+}
+
+} // anonymous namespace
+
+
+SSTMultilevelPartition::SSTMultilevelPartition(RankInfo total_ranks, RankInfo UNUSED(my_rank), int verbosity) :
+    SSTPartitioner(),
+    world_size(total_ranks),
+    bondWeight(INT64_MAX)
+{
+    partOutput = new Output("MultilevelPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTMultilevelPartition::~SSTMultilevelPartition()
+{
+    delete partOutput;
+}
+
+void
+SSTMultilevelPartition::partition(const Graph& graph, const std::vector<uint32_t>& ids, uint32_t firstPart,
+                                  uint32_t numParts, std::vector<uint32_t>& parts, uint32_t threads)
+{
+    if ( numParts == 1 || graph.size() == 0 ) {
+        for ( uint32_t id : ids ) parts[id] = firstPart;
+        return;
+    }
+
+    // Seeded by the parts being split so that the result does not
+    // depend on how many threads split them
+    std::mt19937 rng(firstPart * 7919 + numParts);
+    uint32_t numParts0 = numParts / 2;
+    std::vector<uint8_t> side = bisect(graph, (double)numParts0 / numParts, rng, bondWeight);
+
+    std::vector<uint32_t> ids0, ids1;
+    Graph graph0 = subgraph(graph, side, 0, ids, ids0);
+    Graph graph1 = subgraph(graph, side, 1, ids, ids1);
+
+    // The halves fill in disjoint entries of parts
+    if ( threads > 1 ) {
+        uint32_t threads0 = threads / 2;
+        std::thread other([&]() {
+                partition(graph1, ids1, firstPart + numParts0, numParts - numParts0, parts, threads - threads0);
+            });
+        partition(graph0, ids0, firstPart, numParts0, parts, threads0);
+        other.join();
+    }
+    else {
+        partition(graph0, ids0, firstPart, numParts0, parts, 1);
+        partition(graph1, ids1, firstPart + numParts0, numParts - numParts0, parts, 1);
+    }
+}
+
+void
+SSTMultilevelPartition::performPartition(PartitionGraph* pgraph)
+{
+    PartitionComponentMap_t& compMap = pgraph->getComponentMap();
+    PartitionLinkMap_t& linkMap = pgraph->getLinkMap();
+    const uint32_t numParts = world_size.rank * world_size.thread;
+
+    // Vertices are numbered in component order.  Without any weights
+    // every component counts the same.
+    Graph graph;
+    std::unordered_map<ComponentId_t, uint32_t> index;
+    bool weighted = false;
+    for ( auto it = compMap.begin(); it != compMap.end(); ++it ) {
+        index[it->id] = graph.vwgt.size();
+        graph.vwgt.push_back(std::max(0.0f, it->weight));
+        if ( it->weight > 0 ) weighted = true;
+    }
+    if ( !weighted ) std::fill(graph.vwgt.begin(), graph.vwgt.end(), 1.0);
+    const size_t n = graph.size();
+
+    // Each link between two vertices adds its cut cost to the weight
+    // of the edge between them
+    struct Edge {
+        uint32_t from, to;
+        int64_t  cost;
+        bool operator<(const Edge& o) const { return from < o.from || ( from == o.from && to < o.to ); }
+    };
+    std::vector<Edge> edges;
+    const size_t numLinks = linkMap.size();
+    // Only edges holding a link below the threshold weigh as much as
+    // the cut cost of one
+    bondWeight = ( latency_threshold != 0 ) ? (int64_t)numLinks + 1 : INT64_MAX;
+    for ( auto it = linkMap.begin(); it != linkMap.end(); ++it ) {
+        auto a = index.find(it->component[0]);
+        auto b = index.find(it->component[1]);
+        if ( a == index.end() || b == index.end() || a->second == b->second ) continue;
+        int64_t cost = getCutCost(*it, numLinks);
+        edges.push_back({ a->second, b->second, cost });
+        edges.push_back({ b->second, a->second, cost });
+    }
+    std::sort(edges.begin(), edges.end());
+    graph.xadj.assign(n + 1, 0);
+    for ( size_t i = 0; i < edges.size(); ) {
+        int64_t cost = 0;
+        size_t j = i;
+        for ( ; j < edges.size() && edges[j].from == edges[i].from && edges[j].to == edges[i].to; j++ ) {
+            cost += edges[j].cost;
+        }
+        graph.adjncy.push_back(edges[i].to);
+        graph.adjwgt.push_back(cost);
+        graph.xadj[edges[i].from + 1]++;
+        i = j;
+    }
+    for ( size_t v = 0; v < n; v++ ) graph.xadj[v+1] += graph.xadj[v];
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a multilevel partition of %zu components and %zu links into %" PRIu32 " parts\n",
+                        n, edges.size() / 2, numParts);
+
+    // Links between ranks go over MPI and cost far more than links
+    // between threads, so the ranks are split apart first on their own
+    // and then each rank is split across its threads.  parts numbers
+    // the threads of each rank consecutively.
+    std::vector<uint32_t> ids(n);
+    std::iota(ids.begin(), ids.end(), 0);
+    std::vector<uint32_t> ranks(n, 0);
+    partition(graph, ids, 0, world_size.rank, ranks, world_size.thread);
+
+    std::vector<uint32_t> parts(n, 0);
+    std::vector<std::vector<uint32_t> > rankIds;
+    std::vector<Graph> rankGraphs = splitParts(graph, ranks, world_size.rank, rankIds);
+    for ( uint32_t r = 0; r < world_size.rank; r++ ) {
+        partition(rankGraphs[r], rankIds[r], r * world_size.thread, world_size.thread, parts, world_size.thread);
+        rankGraphs[r] = Graph();
+    }
+
+    size_t v = 0;
+    for ( auto it = compMap.begin(); it != compMap.end(); ++it, ++v ) {
+        it->rank = RankInfo(ranks[v], parts[v] % world_size.thread);
+    }
+
+    std::vector<double> partWeight(numParts, 0);
+    for ( v = 0; v < n; v++ ) partWeight[parts[v]] += graph.vwgt[v];
+    size_t cut = 0;
+    size_t rankCut = 0;
+    size_t cutBelow = 0;
+    SimTime_t lookahead = MAX_SIMTIME_T;
+    for ( auto it = linkMap.begin(); it != linkMap.end(); ++it ) {
+        auto a = index.find(it->component[0]);
+        auto b = index.find(it->component[1]);
+        if ( a == index.end() || b == index.end() || parts[a->second] == parts[b->second] ) continue;
+        cut++;
+        if ( ranks[a->second] != ranks[b->second] ) rankCut++;
+        if ( it->getMinLatency() < latency_threshold ) cutBelow++;
+        lookahead = std::min(lookahead, it->getMinLatency());
+    }
+    double total = totalWeight(graph);
+    double heaviest = *std::max_element(partWeight.begin(), partWeight.end());
+    partOutput->verbose(CALL_INFO, 1, 0, "Multilevel partition cut %zu links, %zu of them between ranks, heaviest part has %.3f times the average weight\n",
+                        cut, rankCut, total > 0 ? heaviest * numParts / total : 0.0);
+    if ( latency_threshold != 0 ) {
+        partOutput->verbose(CALL_INFO, 1, 0, "%zu cut links are below the latency threshold of %" PRIu64 ", the lowest cut latency is %" PRIu64 "\n",
+                            cutBelow, latency_threshold, lookahead);
+    }
+}
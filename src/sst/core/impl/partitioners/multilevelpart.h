@@ -0,0 +1,100 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+#define SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+
+#include <vector>
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sstpart.h"
+
+#include "sst/core/eli/elementinfo.h"
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Multilevel graph partitioner.  The graph is first split across the ranks
+and then each rank across its threads, both by recursive bisection, so
+that the links cut between ranks are minimized ahead of those between
+threads.  Each bisection coarsens the graph by heavy-edge matching,
+bisects the coarsest graph by growing one side from a seed, and then
+refines the cut with Fiduccia-Mattheyses passes while projecting it back
+to the original graph.  Parts are balanced by component weight and the
+number of links cut is minimized, with links below the latency threshold
+costing more to cut than all the others together.  Independent
+bisections run in parallel on up to as many threads as each rank will
+run.
+*/
+class SSTMultilevelPartition : public SST::Partition::SSTPartitioner {
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTMultilevelPartition,
+        "sst",
+        "multilevel",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel recursive bisection (heavy-edge matching, greedy growing, Fiduccia-Mattheyses refinement) that balances component weight and minimizes the links cut.")
+
+    /** Graph of the part being bisected, as compressed adjacency lists */
+    struct Graph {
+        std::vector<double>   vwgt;
+        std::vector<uint32_t> xadj;
+        std::vector<uint32_t> adjncy;
+        std::vector<int64_t>  adjwgt;
+
+        size_t size() const { return vwgt.size(); }
+    };
+
+protected:
+    /** Number of ranks and threads in the simulation */
+    RankInfo world_size;
+    /** Output object to print partitioning information */
+    Output* partOutput;
+    /** Edges at least this heavy hold a link below the latency
+     * threshold and are collapsed before coarsening */
+    int64_t bondWeight;
+
+    /** Split the vertices of graph, whose ids in the whole graph are
+     * in ids, into parts [firstPart, firstPart + numParts) */
+    void partition(const Graph& graph, const std::vector<uint32_t>& ids, uint32_t firstPart,
+                   uint32_t numParts, std::vector<uint32_t>& parts, uint32_t threads);
+
+public:
+    /**
+       Creates a new multilevel partitioner.
+       \param total_ranks Number of ranks and threads in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTMultilevelPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity);
+    ~SSTMultilevelPartition();
+
+    void performPartition(PartitionGraph* graph) override;
+
+    void performPartition(ConfigGraph* graph) override {
+        SST::Partition::SSTPartitioner::performPartition(graph);
+    }
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
@@ -63,18 +63,18 @@ SimplePartitioner::SimplePartitioner(RankInfo total_ranks, RankInfo UNUSED(my_ra
 
     // Cost up all of the links between two sets (that is all links which originate in A
     // and connect to a vertex in B
-    static SimTime_t cost_external_links(ComponentId_t* setA, 
+    static int64_t cost_external_links(ComponentId_t* setA, 
                 const int lengthA,
                 ComponentId_t* setB,
                 const int lengthB,
-                map<ComponentId_t, map<ComponentId_t, SimTime_t>*>& timeTable) {
+                map<ComponentId_t, map<ComponentId_t, int64_t>*>& timeTable) {
 
-        SimTime_t cost = 0;
+        int64_t cost = 0;
 
         for(int i = 0; i < lengthA; i++) {
-            map<ComponentId_t, SimTime_t>* compMap = timeTable[setA[i]];
+            map<ComponentId_t, int64_t>* compMap = timeTable[setA[i]];
 
-            for(map<ComponentId_t, SimTime_t>::const_iterator compMapItr = compMap->begin();
+            for(map<ComponentId_t, int64_t>::const_iterator compMapItr = compMap->begin();
                 compMapItr != compMap->end();
                 compMapItr++) {
 
@@ -91,10 +91,10 @@ SimplePartitioner::SimplePartitioner(RankInfo total_ranks, RankInfo UNUSED(my_ra
     void SimplePartitioner::simple_partition_step(PartitionComponentMap_t& component_map,
             ComponentId_t* setA, const int lengthA, int rankA,
             ComponentId_t* setB, const int lengthB, int rankB,
-            map<ComponentId_t, map<ComponentId_t, SimTime_t>*> timeTable,
+            map<ComponentId_t, map<ComponentId_t, int64_t>*> timeTable,
             int step) {
 
-        SimTime_t costExt = cost_external_links(setA, lengthA, setB, lengthB, timeTable);
+        int64_t costExt = cost_external_links(setA, lengthA, setB, lengthB, timeTable);
 
         for(int i = 0; i < lengthA; i++) {
             for(int j = 0; j < lengthB; j++) {
@@ -102,7 +102,7 @@ SimplePartitioner::SimplePartitioner(RankInfo total_ranks, RankInfo UNUSED(my_ra
                 setA[i] = setB[j]; 
                 setB[j] = tempA;
 
-                SimTime_t newCost = cost_external_links(setA, lengthA, setB, lengthB, timeTable);
+                int64_t newCost = cost_external_links(setA, lengthA, setB, lengthB, timeTable);
 
                 // check higher? if yes then keep otherwise swap back 
                 if(newCost >= costExt) {
@@ -208,7 +208,15 @@ SimplePartitioner::SimplePartitioner(RankInfo total_ranks, RankInfo UNUSED(my_ra
             int indexB = 0;
             int count  = 0;
 
-            map<ComponentId_t, map<ComponentId_t, SimTime_t>*> timeTable;
+            map<ComponentId_t, map<ComponentId_t, int64_t>*> timeTable;
+
+            // Cutting a link below the latency threshold loses more
+            // than cutting every other link gains
+            PartitionLinkMap_t& allLinks = graph->getLinkMap();
+            int64_t latencySum = 0;
+            for(PartitionLinkMap_t::iterator linkItr = allLinks.begin(); linkItr != allLinks.end(); ++linkItr) {
+                latencySum += linkItr->getMinLatency();
+            }
 
             // size_t nComp = component_map.size();
             // for(size_t theComponent = 0 ; theComponent < nComp ; theComponent++ ) {
@@ -218,7 +226,7 @@ SimplePartitioner::SimplePartitioner(RankInfo total_ranks, RankInfo UNUSED(my_ra
 
                 ComponentId_t theComponent = (*compItr).id;
 
-                map<ComponentId_t, SimTime_t>* compConnectMap = new map<ComponentId_t, SimTime_t>();
+                map<ComponentId_t, int64_t>* compConnectMap = new map<ComponentId_t, int64_t>();
                 timeTable[theComponent] = compConnectMap;
 
                 if(count++ % 2 == 0) {
@@ -237,7 +245,9 @@ SimplePartitioner::SimplePartitioner(RankInfo total_ranks, RankInfo UNUSED(my_ra
 
                     // ConfigLink* theLink = (*linkItr);
                     PartitionLink& theLink = linkMap[*linkItr];
-                    compConnectMap->insert( pair<ComponentId_t, SimTime_t>(theLink.component[1], theLink.getMinLatency()) );
+                    int64_t value = theLink.getMinLatency();
+                    if ( getCutCost(theLink, allLinks.size()) > 1 ) value = -(latencySum + 1);
+                    compConnectMap->insert( pair<ComponentId_t, int64_t>(theLink.component[1], value) );
                 }
             }
 
@@ -38,14 +38,16 @@ private:
     RankInfo world_size;
     uint32_t total_parts;
 
+    // The first splits separate the low bits of the part number, so
+    // those pick the rank and the splits between ranks come first
     RankInfo convertPartNum(uint32_t partNum) {
-        return RankInfo(partNum / world_size.thread, partNum % world_size.thread);
+        return RankInfo(partNum % world_size.rank, partNum / world_size.rank);
     }
 
     void simple_partition_step(PartitionComponentMap_t& component_map,
             ComponentId_t* setA, const int lengthA, int rankA,
             ComponentId_t* setB, const int lengthB, int rankB,
-            std::map<ComponentId_t, std::map<ComponentId_t, SimTime_t>*> timeTable,
+            std::map<ComponentId_t, std::map<ComponentId_t, int64_t>*> timeTable,
             int step);
 public:
 
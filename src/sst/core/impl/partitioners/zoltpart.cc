@@ -15,11 +15,16 @@
 #include "sst/core/warnmacros.h"
 #include "sst/core/configGraph.h"
 
+#include <vector>
+
 #ifdef HAVE_ZOLTAN
 
 using namespace std;
 
 static SST::Output* partOutput;
+// Weight of each link, in link map order, when links below the latency
+// threshold are weighted; empty otherwise
+static std::vector<float> edgeWeights;
 
 namespace SST {
 namespace IMPL {
@@ -116,7 +121,7 @@ static void sst_zoltan_get_edge_list(void *data, int UNUSED(sizeGID), int UNUSED
     int num_obj, ZOLTAN_ID_PTR UNUSED(globalID), ZOLTAN_ID_PTR UNUSED(localID),
     int *num_edges,
     ZOLTAN_ID_PTR nborGID, int *nborProc,
-    int UNUSED(wgt_dim), float *UNUSED(ewgts), int *ierr) {
+    int wgt_dim, float *ewgts, int *ierr) {
 
     int rank = 0;
     MPI_Comm_rank(MPI_COMM_WORLD, & rank);
@@ -136,12 +141,14 @@ static void sst_zoltan_get_edge_list(void *data, int UNUSED(sizeGID), int UNUSED
         
         ZOLTAN_ID_PTR next_nbor_entry = nborGID;
         int* next_proc_entry = nborProc;
+        float* next_wgt_entry = ewgts;
         
         for(int i = 0; i < num_obj; ++i) {
             int this_comp_links = num_edges[i];
             PartitionLinkMap_t::iterator map_itr;
+            size_t link_index = 0;
             
-            for(map_itr = link_map.begin(); map_itr != link_map.end(); map_itr++) {
+            for(map_itr = link_map.begin(); map_itr != link_map.end(); map_itr++, link_index++) {
                 if(this_comp_links < 0) {
                     // Something went wrong here as we have a count of how many edges
                     // we are expecting, we decrement. If this gets below 0 we got the count
@@ -152,6 +159,10 @@ static void sst_zoltan_get_edge_list(void *data, int UNUSED(sizeGID), int UNUSED
                 if(map_itr->component[0] == (ComponentId_t) i) {
                     next_nbor_entry[0] = (int) map_itr->component[1];
                     next_proc_entry[0] = (int) 0;
+                    if(wgt_dim > 0) {
+                        next_wgt_entry[0] = edgeWeights[link_index];
+                        next_wgt_entry += wgt_dim;
+                    }
                     
                     next_proc_entry++;
                     next_nbor_entry++;
@@ -234,6 +245,17 @@ void SSTZoltanPartition::performPartition(PartitionGraph* graph) {
     
     partOutput->verbose(CALL_INFO, 1, 0, "# Preparing partitioning...\n");
     
+    // Weight the links below the latency threshold so Zoltan avoids cutting them
+    edgeWeights.clear();
+    if(0 != latency_threshold && 0 == rank.rank) {
+        PartitionLinkMap_t& link_map = graph->getLinkMap();
+        edgeWeights.reserve(link_map.size());
+        for(PartitionLinkMap_t::iterator map_itr = link_map.begin(); map_itr != link_map.end(); map_itr++) {
+            edgeWeights.push_back((float) getCutCost(*map_itr, link_map.size()));
+        }
+    }
+    Zoltan_Set_Param(zolt_config, "EDGE_WEIGHT_DIM", 0 != latency_threshold ? "1" : "0");
+
     // Register the call backs for this class
     Zoltan_Set_Num_Obj_Fn(zolt_config, sst_zoltan_count_vertices, graph);
     Zoltan_Set_Obj_List_Fn(zolt_config, sst_zoltan_get_vertex_list, graph);
@@ -0,0 +1,249 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexLadder.h"
+
+#include <algorithm>
+
+#include "sst/core/output.h"
+#include "sst/core/params.h"
+
+namespace SST {
+namespace IMPL {
+
+TimeVortexLadder::TimeVortexLadder(Params& params) :
+    TimeVortex(),
+    topLimit(0),
+    topMin(MAX_SIMTIME_T),
+    topMax(0),
+    nRungs(0),
+    insertOrder(0),
+    current_depth(0),
+    max_depth(0)
+{
+    threshold = params.find<size_t>("threshold", 50);
+    maxRungs = params.find<size_t>("max_rungs", 8);
+
+    // A rung gets one bucket per activity and is only spawned for more
+    // than threshold of them.  A threshold of at least 1 gives every
+    // rung at least two buckets, which it needs to make progress.
+    if ( threshold < 1 ) threshold = 1;
+    if ( maxRungs < 1 ) maxRungs = 1;
+    rungs.resize(maxRungs);
+}
+
+TimeVortexLadder::~TimeVortexLadder()
+{
+    // Activities in TimeVortexLadder all need to be deleted
+    for ( auto act : top ) delete act;
+    for ( auto& rung : rungs ) {
+        for ( auto& bucket : rung.buckets ) {
+            for ( auto act : bucket ) delete act;
+        }
+    }
+    for ( auto act : bottom ) delete act;
+}
+
+bool TimeVortexLadder::empty()
+{
+    return current_depth == 0;
+}
+
+int TimeVortexLadder::size()
+{
+    return current_depth;
+}
+
+void TimeVortexLadder::insert(Activity* activity)
+{
+    activity->setQueueOrder(insertOrder++);
+    current_depth++;
+    if ( current_depth > max_depth ) {
+        max_depth = current_depth;
+    }
+
+    SimTime_t time = activity->getDeliveryTime();
+
+    // Beyond everything that has been handed down the ladder
+    if ( time > topLimit ) {
+        top.push_back(activity);
+        if ( time < topMin ) topMin = time;
+        if ( time > topMax ) topMax = time;
+        return;
+    }
+
+    // Rungs are checked coarsest first.  Each rung only covers times
+    // below the current bucket of the rung above it, so the first
+    // rung whose current bucket starts at or before time owns it.
+    for ( size_t i = 0; i < nRungs; i++ ) {
+        Rung& rung = rungs[i];
+        if ( time >= rung.curStart() ) {
+            size_t index = (time - rung.start) / rung.width;
+            if ( index >= rung.nbuckets ) index = rung.nbuckets - 1;
+            rung.buckets[index].push_back(activity);
+            return;
+        }
+    }
+
+    insertBottom(activity);
+}
+
+void TimeVortexLadder::insertBatch(Activity* const* batch, size_t count)
+{
+    // Inserts are already O(1), just avoid the virtual call per activity
+    for ( size_t i = 0; i < count; i++ ) {
+        TimeVortexLadder::insert(batch[i]);
+    }
+}
+
+Activity* TimeVortexLadder::pop()
+{
+    if ( bottom.empty() && !refillBottom() ) return nullptr;
+    Activity* ret_val = bottom.back();
+    bottom.pop_back();
+    current_depth--;
+    return ret_val;
+}
+
+Activity* TimeVortexLadder::front()
+{
+    if ( bottom.empty() && !refillBottom() ) return nullptr;
+    return bottom.back();
+}
+
+void TimeVortexLadder::print(Output &out) const
+{
+    out.output("TimeVortex state:\n");
+    out.output("  top: %zu activities, rungs: %zu, bottom: %zu activities\n",
+               top.size(), nRungs, bottom.size());
+
+    for ( auto it = bottom.rbegin(); it != bottom.rend(); ++it ) {
+        (*it)->print("  ", out);
+    }
+    for ( size_t i = nRungs; i > 0; i-- ) {
+        const Rung& rung = rungs[i-1];
+        for ( size_t j = rung.cur; j < rung.nbuckets; j++ ) {
+            for ( auto act : rung.buckets[j] ) {
+                act->print("  ", out);
+            }
+        }
+    }
+    for ( auto act : top ) {
+        act->print("  ", out);
+    }
+}
+
+bool TimeVortexLadder::refillBottom()
+{
+    while ( bottom.empty() ) {
+        if ( nRungs == 0 ) {
+            if ( top.empty() ) return false;
+
+            // Everything up to topMax now belongs to the ladder
+            topLimit = topMax;
+            if ( top.size() > threshold && topMin != topMax ) {
+                spawnRung(top, topMin, topMax);
+            }
+            else {
+                fillBottom(top);
+            }
+            topMin = MAX_SIMTIME_T;
+            topMax = 0;
+            continue;
+        }
+
+        Rung& rung = rungs[nRungs-1];
+        while ( rung.cur < rung.nbuckets && rung.buckets[rung.cur].empty() ) {
+            rung.cur++;
+        }
+        if ( rung.cur == rung.nbuckets ) {
+            nRungs--;
+            continue;
+        }
+
+        // Take the bucket out of the rung before the rung can be
+        // reused by spawnRung()
+        spill.swap(rung.buckets[rung.cur]);
+        rung.cur++;
+        // An exhausted rung is dropped right away, otherwise its
+        // last bucket would still accept inserts
+        if ( rung.cur == rung.nbuckets ) nRungs--;
+
+        if ( spill.size() > threshold && nRungs < maxRungs ) {
+            auto minmax = std::minmax_element(spill.begin(), spill.end(), Activity::less_time());
+            SimTime_t min_time = (*minmax.first)->getDeliveryTime();
+            SimTime_t max_time = (*minmax.second)->getDeliveryTime();
+            if ( min_time != max_time ) {
+                spawnRung(spill, min_time, max_time);
+                continue;
+            }
+        }
+        fillBottom(spill);
+    }
+    return true;
+}
+
+void TimeVortexLadder::spawnRung(bucket_t& src, SimTime_t min_time, SimTime_t max_time)
+{
+    Rung& rung = rungs[nRungs++];
+    size_t nbuckets = src.size();
+
+    rung.start = min_time;
+    rung.width = (max_time - min_time) / nbuckets + 1;
+    rung.cur = 0;
+    rung.nbuckets = nbuckets;
+    if ( rung.buckets.size() < nbuckets ) rung.buckets.resize(nbuckets);
+
+    for ( auto act : src ) {
+        size_t index = (act->getDeliveryTime() - min_time) / rung.width;
+        if ( index >= nbuckets ) index = nbuckets - 1;
+        rung.buckets[index].push_back(act);
+    }
+    src.clear();
+}
+
+void TimeVortexLadder::fillBottom(bucket_t& src)
+{
+    bottom.swap(src);
+    src.clear();
+    std::sort(bottom.begin(), bottom.end(), compare);
+}
+
+void TimeVortexLadder::insertBottom(Activity* activity)
+{
+    // Keep bottom short by splitting it into a new rung when it gets
+    // too long.  Can't split if everything is at the same time.
+    if ( bottom.size() > threshold && nRungs < maxRungs &&
+         bottom.front()->getDeliveryTime() != bottom.back()->getDeliveryTime() ) {
+        SimTime_t min_time = bottom.back()->getDeliveryTime();
+        SimTime_t max_time = bottom.front()->getDeliveryTime();
+        spill.swap(bottom);
+        spawnRung(spill, min_time, max_time);
+
+        Rung& rung = rungs[nRungs-1];
+        if ( activity->getDeliveryTime() >= rung.start ) {
+            size_t index = (activity->getDeliveryTime() - rung.start) / rung.width;
+            if ( index >= rung.nbuckets ) index = rung.nbuckets - 1;
+            rung.buckets[index].push_back(activity);
+            return;
+        }
+    }
+
+    auto pos = std::upper_bound(bottom.begin(), bottom.end(), activity, compare);
+    bottom.insert(pos, activity);
+}
+
+
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,135 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
+
+#include <vector>
+
+#include "sst/core/timeVortex.h"
+#include "sst/core/eli/elementinfo.h"
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+
+/**
+ * Primary Event Queue based on a ladder queue (Tang, Goh and Thng).
+ *
+ * Activities are kept in three tiers:
+ *   - top:    an unsorted list of everything later than topLimit
+ *   - rungs:  arrays of unsorted buckets, each rung a finer
+ *             subdivision of a single bucket of the rung above it
+ *   - bottom: a small sorted list holding the earliest activities
+ *
+ * Inserts are an append to top or to a rung bucket; only the
+ * activities that reach bottom are ever sorted, which gives
+ * amortized O(1) insert and pop.  Ordering matches
+ * TimeVortexPQ exactly, since bottom is sorted with the same
+ * comparator.
+ */
+class TimeVortexLadder : public TimeVortex {
+
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadder,
+        "sst",
+        "timevortex.ladder",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on a ladder queue.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"threshold", "Number of activities in a bucket above which the bucket is split into a new rung instead of being sorted", "50"},
+        {"max_rungs", "Maximum number of rungs in the ladder", "8"}
+    )
+
+public:
+    TimeVortexLadder(Params& params);
+    ~TimeVortexLadder();
+
+    bool empty() override;
+    int size() override;
+    void insert(Activity* activity) override;
+    void insertBatch(Activity* const* batch, size_t count) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output &out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+#ifdef SST_ENFORCE_EVENT_ORDERING
+    typedef Activity::pq_less_time_priority_order compare_t;
+#else
+    typedef Activity::pq_less_time_priority compare_t;
+#endif
+    typedef std::vector<Activity*> bucket_t;
+
+    struct Rung {
+        SimTime_t start;
+        SimTime_t width;
+        /* Index of the first bucket not yet handed down */
+        size_t cur;
+        size_t nbuckets;
+        /* Storage is kept across uses of the rung to avoid
+         * reallocating buckets on every spawn */
+        std::vector<bucket_t> buckets;
+
+        SimTime_t curStart() const { return start + cur * width; }
+    };
+
+    /** Move activities down the ladder until bottom is non-empty.
+     * @return false if the queue is empty */
+    bool refillBottom();
+    /** Create a new rung below the existing ones from a list of
+     * activities whose times lie in [min_time, max_time] */
+    void spawnRung(bucket_t& src, SimTime_t min_time, SimTime_t max_time);
+    /** Sort a list of activities into bottom */
+    void fillBottom(bucket_t& src);
+    void insertBottom(Activity* activity);
+
+    compare_t compare;
+
+    bucket_t top;
+    /* Latest time that has been handed down the ladder */
+    SimTime_t topLimit;
+    SimTime_t topMin;
+    SimTime_t topMax;
+
+    std::vector<Rung> rungs;
+    size_t nRungs;
+
+    /* Sorted latest first so the next activity is at the back */
+    bucket_t bottom;
+    /* Scratch list used while moving activities between tiers */
+    bucket_t spill;
+
+    size_t threshold;
+    size_t maxRungs;
+
+    uint64_t insertOrder;
+
+    uint64_t current_depth;
+    uint64_t max_depth;
+
+};
+
+} // namespace IMPL
+} //namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
@@ -59,6 +59,18 @@ void TimeVortexPQ::insert(Activity* activity)
     }
 }
 
+void TimeVortexPQ::insertBatch(Activity* const* batch, size_t count)
+{
+    for ( size_t i = 0; i < count; i++ ) {
+        batch[i]->setQueueOrder(insertOrder++);
+    }
+    data.pushBatch(batch, count);
+    current_depth += count;
+    if ( current_depth > max_depth ) {
+        max_depth = current_depth;
+    }
+}
+
 Activity* TimeVortexPQ::pop()
 {
     if ( data.empty() ) return nullptr;
@@ -12,6 +12,7 @@
 #ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXPQ_H
 #define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXPQ_H
 
+#include <algorithm>
 #include <functional>
 #include <queue>
 #include <vector>
@@ -49,6 +50,7 @@ public:
     bool empty() override;
     int size() override;
     void insert(Activity* activity) override;
+    void insertBatch(Activity* const* batch, size_t count) override;
     Activity* pop() override;
     Activity* front() override;
 
@@ -60,10 +62,25 @@ public:
     
 private:
 #ifdef SST_ENFORCE_EVENT_ORDERING
-    typedef std::priority_queue<Activity*, std::vector<Activity*>, Activity::pq_less_time_priority_order> dataType_t;
+    typedef std::priority_queue<Activity*, std::vector<Activity*>, Activity::pq_less_time_priority_order> pqType_t;
 #else
-    typedef std::priority_queue<Activity*, std::vector<Activity*>, Activity::pq_less_time_priority> dataType_t;
+    typedef std::priority_queue<Activity*, std::vector<Activity*>, Activity::pq_less_time_priority> pqType_t;
 #endif
+    /* priority_queue with access to the underlying container so a
+     * batch can be added with a single heap fix-up */
+    class dataType_t : public pqType_t {
+    public:
+        void pushBatch(Activity* const* batch, size_t count) {
+            // Rebuilding the heap is linear in its size, so only do
+            // it when the batch is at least as large as the heap
+            if ( count < c.size() ) {
+                for ( size_t i = 0; i < count; i++ ) push(batch[i]);
+                return;
+            }
+            c.insert(c.end(), batch, batch + count);
+            std::make_heap(c.begin(), c.end(), comp);
+        }
+    };
     dataType_t data;
     uint64_t insertOrder;
 
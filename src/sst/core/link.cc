@@ -14,6 +14,7 @@
 #include "sst/core/link.h"
 
 #include <utility>
+#include <vector>
 
 #include "sst/core/event.h"
 #include "sst/core/initQueue.h"
@@ -43,7 +44,7 @@ Link::Link(LinkId_t id) :
 {
     recvQueue = uninitQueue;
     untimedQueue = nullptr;
-    configuredQueue = Simulation::getSimulation()->getTimeVortex();
+    configuredQueue = Simulation::getSimulation()->getLinkQueue();
 }
 
 Link::Link() :
@@ -56,7 +57,7 @@ Link::Link() :
 {
     recvQueue = uninitQueue;
     untimedQueue = nullptr;
-    configuredQueue = Simulation::getSimulation()->getTimeVortex();
+    configuredQueue = Simulation::getSimulation()->getLinkQueue();
 }
 
 Link::~Link() {
@@ -119,7 +120,7 @@ void Link::send( SimTime_t delay, TimeConverter* tc, Event* event ) {
         Simulation::getSimulation()->getSimulationOutput().fatal(CALL_INFO, 1, "Cannot send an event on Link with nullptr TimeConverter\n");
     }
     
-    Cycle_t cycle = Simulation::getSimulation()->getCurrentSimCycle() +
+    Cycle_t cycle = *Simulation::getContext().currentSimCycle +
         tc->convertToCoreTime(delay) + latency;
     
     if ( event == nullptr ) {
@@ -138,6 +139,36 @@ void Link::send( SimTime_t delay, TimeConverter* tc, Event* event ) {
 }
     
 
+void Link::sendBatch( size_t count, const SimTime_t* delays, TimeConverter* tc, Event** events ) {
+    if ( tc == nullptr ) {
+        Simulation::getSimulation()->getSimulationOutput().fatal(CALL_INFO, 1, "Cannot send an event on Link with nullptr TimeConverter\n");
+    }
+
+    // Reused across calls so a batch does not allocate
+    static thread_local std::vector<Activity*> batch;
+    batch.resize(count);
+
+    Cycle_t base = *Simulation::getContext().currentSimCycle + latency;
+    SimTime_t factor = tc->getFactor();
+
+    for ( size_t i = 0; i < count; i++ ) {
+        Event* event = events[i];
+        if ( event == nullptr ) {
+            event = new NullEvent();
+        }
+        event->setDeliveryTime(base + delays[i] * factor);
+        event->setDeliveryLink(id,pair_link);
+
+#if __SST_DEBUG_EVENT_TRACKING__
+        event->addSendComponent(comp, ctype, port);
+        event->addRecvComponent(pair_link->comp, pair_link->ctype, pair_link->port);
+#endif
+        batch[i] = event;
+    }
+
+    pair_link->recvQueue->insertBatch(batch.data(), count);
+}
+
 Event* Link::recv() 
 {
     // Check to make sure this is a polling link
@@ -147,11 +178,10 @@ Event* Link::recv()
     }
     
     Event* event = nullptr;
-    Simulation *simulation = Simulation::getSimulation();
 
     if ( !recvQueue->empty() ) {
     Activity* activity = recvQueue->front();
-    if ( activity->getDeliveryTime() <=  simulation->getCurrentSimCycle() ) {
+    if ( activity->getDeliveryTime() <= *Simulation::getContext().currentSimCycle ) {
         event = static_cast<Event*>(activity);
         recvQueue->pop();
     }
@@ -164,8 +194,9 @@ void Link::sendUntimedData(Event* data)
     if ( pair_link->untimedQueue == nullptr ) {
         pair_link->untimedQueue = new InitQueue();
     }
-    Simulation::getSimulation()->untimed_msg_count++;
-    data->setDeliveryTime(Simulation::getSimulation()->untimed_phase + 1);
+    Simulation* sim = Simulation::getSimulation();
+    sim->untimed_msg_count++;
+    data->setDeliveryTime(sim->untimed_phase + 1);
     data->setDeliveryLink(id,pair_link);
     
     pair_link->untimedQueue->insert(data);
@@ -106,6 +106,26 @@ public:
         send( 0, event );
     }
 
+    /** Send a batch of events over the link.  Equivalent to calling
+      send(delays[i], tc, events[i]) for each event in order, but the
+      events are handed to the receiving queue in a single insert.
+      @param count - number of events in the batch
+      @param delays - additional delay for each event
+      @param tc - time converter to specify units for the additional delays
+      @param events - the Events to send
+      */
+    void sendBatch( size_t count, const SimTime_t* delays, TimeConverter* tc, Event** events );
+
+    /** Send a batch of events over the link, with delays in units of
+      the Link's default timebase.
+      @param count - number of events in the batch
+      @param delays - additional delay for each event
+      @param events - the Events to send
+      */
+    inline void sendBatch( size_t count, const SimTime_t* delays, Event** events ) {
+        sendBatch(count, delays, defaultTimeBase, events);
+    }
+
 
     /** Retrieve a pending event from the Link. For links which do not
       have a set event handler, they can be polled with this function.
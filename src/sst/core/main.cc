@@ -52,6 +52,7 @@ REENABLE_WARNING
 #endif
 #include "sst/core/memuse.h"
 #include "sst/core/iouse.h"
+#include "sst/core/threadpin.h"
 
 #include <sys/resource.h>
 
@@ -63,6 +64,8 @@ REENABLE_WARNING
 #include "sst/core/cfgoutput/dotConfigOutput.h"
 #include "sst/core/cfgoutput/xmlConfigOutput.h"
 #include "sst/core/cfgoutput/jsonConfigOutput.h"
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
+#include "sst/core/model/binarymodel.h"
 
 #include "sst/core/eli/elementinfo.h"
 
@@ -194,12 +197,97 @@ static void doGraphOutput(SST::Config *cfg, ConfigGraph *graph) {
         graphOutputs.push_back( new JSONConfigGraphOutput(cfg->output_json.c_str()) );
     }
 
+    // User asked us to dump the config graph in binary format (for fast startup)
+    if(cfg->output_binary != "") {
+        graphOutputs.push_back( new BinaryConfigGraphOutput(cfg->output_binary.c_str()) );
+    }
+
     for(size_t i = 0; i < graphOutputs.size(); i++) {
         graphOutputs[i]->generate(cfg, graph);
         delete graphOutputs[i];
     }
 }
 
+#ifdef SST_CONFIG_HAVE_MPI
+// Connect the links a parallel load left with one end on this rank.
+// Each link name belongs to one rank (by hash), which pairs the two ends,
+// numbers the link and sends each side the other end's component.
+static void connectBoundaryLinks(ConfigGraph* graph, const RankInfo& myRank, const RankInfo& world_size)
+{
+    // Cross rank links are numbered after every rank's local links
+    int32_t localLinks = graph->getLinkMap().size();
+
+    std::vector<ConfigLink> boundary;
+    graph->extractBoundaryLinks(boundary);
+
+    std::vector<std::vector<ConfigLink> > sendLinks(world_size.rank), recvLinks;
+    std::vector<std::vector<ConfigComponent> > sendComps(world_size.rank), recvComps;
+    std::hash<std::string> hasher;
+    for ( ConfigLink& link : boundary ) {
+        uint32_t owner = hasher(link.name) % world_size.rank;
+        sendLinks[owner].push_back(link);
+        sendComps[owner].push_back(graph->findComponent(COMPONENT_ID_MASK(link.component[0]))->cloneWithoutLinksOrParams());
+    }
+    boundary.clear();
+    Comms::all_to_allv(sendLinks, recvLinks);
+    Comms::all_to_allv(sendComps, recvComps);
+
+    // Pair up the ends of the links this rank owns
+    std::map<std::string, std::vector<std::pair<uint32_t, size_t> > > ends;
+    for ( uint32_t r = 0; r < world_size.rank; r++ ) {
+        for ( size_t i = 0; i < recvLinks[r].size(); i++ ) {
+            ends[recvLinks[r][i].name].emplace_back(r, i);
+        }
+    }
+    for ( auto& end : ends ) {
+        if ( end.second.size() == 1 ) {
+            const ConfigLink& link = recvLinks[end.second[0].first][end.second[0].second];
+            g_output.fatal(CALL_INFO, 1, "Found dangling link: %s.  It is connected on one side to component %s.\n",
+                    link.name.c_str(), recvComps[end.second[0].first][end.second[0].second].name.c_str());
+        }
+        if ( end.second.size() > 2 ) {
+            g_output.fatal(CALL_INFO, 1, "Link %s referenced more than two times\n", end.first.c_str());
+        }
+    }
+
+    int32_t firstId = 0, offset = 0, count = ends.size();
+    MPI_Allreduce(&localLinks, &firstId, 1, MPI_INT32_T, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Exscan(&count, &offset, 1, MPI_INT32_T, MPI_SUM, MPI_COMM_WORLD);
+    if ( 0 == myRank.rank ) offset = 0;
+
+    for ( auto& v : sendLinks ) v.clear();
+    for ( auto& v : sendComps ) v.clear();
+    LinkId_t id = firstId + offset;
+    for ( auto& end : ends ) {
+        ConfigLink link = recvLinks[end.second[0].first][end.second[0].second];
+        const ConfigLink& other = recvLinks[end.second[1].first][end.second[1].second];
+        link.id = id++;
+        link.component[1] = other.component[0];
+        link.port[1] = other.port[0];
+        link.latency_str[1] = other.latency_str[0];
+        link.no_cut |= other.no_cut;
+        link.current_ref = 2;
+
+        for ( int i = 0; i < 2; i++ ) {
+            const std::pair<uint32_t, size_t>& remote = end.second[1 - i];
+            sendLinks[end.second[i].first].push_back(link);
+            sendComps[end.second[i].first].push_back(recvComps[remote.first][remote.second]);
+        }
+    }
+    recvLinks.clear();
+    recvComps.clear();
+    Comms::all_to_allv(sendLinks, recvLinks);
+    Comms::all_to_allv(sendComps, recvComps);
+
+    std::vector<ConfigComponent> remotes;
+    for ( uint32_t r = 0; r < world_size.rank; r++ ) {
+        boundary.insert(boundary.end(), recvLinks[r].begin(), recvLinks[r].end());
+        remotes.insert(remotes.end(), recvComps[r].begin(), recvComps[r].end());
+    }
+    graph->addBoundaryLinks(boundary, remotes);
+}
+#endif
+
 
 typedef struct {
     RankInfo myRank;
@@ -215,6 +303,7 @@ typedef struct {
     uint64_t max_tv_depth;
     uint64_t current_tv_depth;
     uint64_t sync_data_size;
+    std::vector<int> cpus;
 
 } SimThreadInfo_t;
 
@@ -226,6 +315,12 @@ void finalize_statEngineConfig(void)
 static void start_simulation(uint32_t tid, SimThreadInfo_t &info, Core::ThreadSafe::Barrier &barrier)
 {
     info.myRank.thread = tid;
+
+    // Bind before the simulation objects are allocated so that their
+    // memory is first touched on the node the thread runs on
+    if ( !info.cpus.empty() && !pinThread(info.cpus) ) {
+        g_output.output("WARNING: Could not bind thread %" PRIu32 " to its CPUs\n", tid);
+    }
     double start_build = sst_get_cpu_time();
 
     if ( tid ) {
@@ -253,8 +348,9 @@ static void start_simulation(uint32_t tid, SimThreadInfo_t &info, Core::ThreadSa
         barrier.wait();
     }
 
+    // Every thread registers its own statistic group clocks
+    finalize_statEngineConfig();
     if ( tid == 0 ) {
-        finalize_statEngineConfig();
         delete info.graph;
     }
 
@@ -390,7 +486,11 @@ main(int argc, char *argv[])
     if ( cfg.configFile != "NONE" ) {
         string file_ext = "";
 
-        if(cfg.configFile.size() > 3) {
+        if(cfg.configFile.size() > 7 &&
+           cfg.configFile.compare(cfg.configFile.size() - 7, 7, ".sstbin") == 0) {
+            modelGen = new SSTBinaryModelDefinition(cfg.configFile, cfg.verbose, &cfg);
+        }
+        else if(cfg.configFile.size() > 3) {
             file_ext = cfg.configFile.substr(cfg.configFile.size() - 3);
 
             if(file_ext == "xml" || file_ext == "sdl") {
@@ -430,14 +530,15 @@ main(int argc, char *argv[])
     double start_graph_gen = sst_get_cpu_time();
     graph = new ConfigGraph();
 
-    // Only rank 0 will populate the graph
-    if ( myRank.rank == 0 ) {
+    // Only rank 0 will populate the graph, unless every rank builds
+    // its own part
+    if ( myRank.rank == 0 || cfg.parallel_load ) {
         graph = modelGen->createConfigGraph();
     }
 
 #ifdef SST_CONFIG_HAVE_MPI
     // Config is done - broadcast it
-    if ( world_size.rank > 1 ) {
+    if ( world_size.rank > 1 && !cfg.parallel_load ) {
         Comms::broadcast(cfg, 0);
     }
 #endif
@@ -445,7 +546,23 @@ main(int argc, char *argv[])
     // Need to initialize TimeLord before we use UnitAlgebra
     Simulation::getTimeLord()->init(cfg.timeBase);
 
-    if ( myRank.rank == 0 ) {
+    if ( cfg.parallel_load ) {
+        // The components this rank built stay here, so the graph is
+        // already partitioned once the links between ranks are connected
+        if ( (uint64_t)world_size.rank > (1ULL << (COMPONENT_ID_BITS - PARALLEL_LOAD_ID_BITS)) ) {
+            g_output.fatal(CALL_INFO, 1, "A parallel load supports at most %llu ranks\n",
+                    1ULL << (COMPONENT_ID_BITS - PARALLEL_LOAD_ID_BITS));
+        }
+        graph->setLocalComponentRanks(myRank, world_size);
+#ifdef SST_CONFIG_HAVE_MPI
+        if ( world_size.rank > 1 ) {
+            connectBoundaryLinks(graph, myRank, world_size);
+        }
+#endif
+        cfg.partitioner = "sst.self";
+    }
+
+    if ( myRank.rank == 0 || cfg.parallel_load ) {
         graph->postCreationCleanup();
 
         // Check config graph to see if there are structural errors.
@@ -478,6 +595,7 @@ main(int argc, char *argv[])
 
     // Get the partitioner.  Built in partitioners are in the "sst" library.
     SSTPartitioner* partitioner = factory->CreatePartitioner(cfg.partitioner, world_size, myRank, cfg.verbose);
+    partitioner->setLatencyThreshold(Simulation::getTimeLord()->getSimCycles(cfg.partitionMinLatency, "partition-min-latency"));
 
 
     if ( partitioner->requiresConfigGraph() ) {
@@ -504,7 +622,7 @@ main(int argc, char *argv[])
     delete partitioner;
 
     // Check the partitioning to make sure it is sane
-    if ( myRank.rank == 0 ) {
+    if ( myRank.rank == 0 || cfg.parallel_load ) {
         if ( !graph->checkRanks( world_size ) ) {
             g_output.fatal(CALL_INFO, 1,
                     "ERROR: Bad partitioning; partition included unknown ranks.\n");
@@ -521,17 +639,23 @@ main(int argc, char *argv[])
 
 
         // Output the partition information is user requests it
-        dump_partition(cfg, graph, world_size);
-        doGraphOutput(&cfg, graph);
+        if ( !cfg.parallel_load || world_size.rank == 1 ) {
+            dump_partition(cfg, graph, world_size);
+            doGraphOutput(&cfg, graph);
+        }
+        else {
+            g_output.verbose(CALL_INFO, 1, 0, "# No rank holds the whole graph with a parallel load, graph output is skipped\n");
+        }
     }
 
     ////// End Partitioning //////
 
     ////// Calculate Minimum Partitioning //////
     SimTime_t min_part = 0xffffffffffffffffl;
-    if ( world_size.rank > 1 ) {
+    SimTime_t min_thread_part = MAX_SIMTIME_T;
+    if ( world_size.rank > 1 || world_size.thread > 1 ) {
         // Check the graph for the minimum latency crossing a partition boundary
-        if ( myRank.rank == 0 ) {
+        if ( myRank.rank == 0 || cfg.parallel_load ) {
             ConfigComponentMap_t comps = graph->getComponentMap();
             ConfigLinkMap_t links = graph->getLinkMap();
             // Find the minimum latency across a partition
@@ -541,7 +665,13 @@ main(int argc, char *argv[])
                 RankInfo rank[2];
                 rank[0] = comps[COMPONENT_ID_MASK(clink.component[0])].rank;
                 rank[1] = comps[COMPONENT_ID_MASK(clink.component[1])].rank;
-                if ( rank[0].rank == rank[1].rank ) continue;
+                if ( rank[0].rank == rank[1].rank ) {
+                    // Only used to report the lookahead between threads
+                    if ( rank[0].thread != rank[1].thread && clink.getMinLatency() < min_thread_part ) {
+                        min_thread_part = clink.getMinLatency();
+                    }
+                    continue;
+                }
                 if ( clink.getMinLatency() < min_part ) {
                     min_part = clink.getMinLatency();
                 }
@@ -559,8 +689,28 @@ main(int argc, char *argv[])
         //     min_part = Simulation::getTimeLord()->getSimCycles("1us","");
         // }
 
-        Comms::broadcast(min_part, 0);
+        if ( world_size.rank > 1 ) {
+            if ( cfg.parallel_load ) {
+                SimTime_t min_parts[2] = { min_part, min_thread_part };
+                MPI_Allreduce(MPI_IN_PLACE, min_parts, 2, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+                min_part = min_parts[0];
+                min_thread_part = min_parts[1];
+            }
+            else {
+                Comms::broadcast(min_part, 0);
+            }
+        }
 #endif
+
+        if ( myRank.rank == 0 ) {
+            UnitAlgebra time_base = Simulation::getTimeLord()->getTimeBase();
+            std::string rank_lookahead = "none";
+            std::string thread_lookahead = "none";
+            if ( world_size.rank > 1 && min_part != MAX_SIMTIME_T ) rank_lookahead = (time_base * min_part).toStringBestSI();
+            if ( world_size.thread > 1 && min_thread_part != MAX_SIMTIME_T ) thread_lookahead = (time_base * min_thread_part).toStringBestSI();
+            g_output.verbose(CALL_INFO, 1, 0, "# Lookahead between ranks: %s, between threads: %s\n",
+                    rank_lookahead.c_str(), thread_lookahead.c_str());
+        }
     }
     ////// End Calculate Minimum Partitioning //////
 
@@ -574,7 +724,7 @@ main(int argc, char *argv[])
 
     ////// Broadcast Graph //////
 #ifdef SST_CONFIG_HAVE_MPI
-    if ( world_size.rank > 1 ) {
+    if ( world_size.rank > 1 && !cfg.parallel_load ) {
         Comms::broadcast(Params::keyMap, 0);
         Comms::broadcast(Params::keyMapReverse, 0);
         Comms::broadcast(Params::nextKeyID, 0);
@@ -660,6 +810,14 @@ main(int argc, char *argv[])
 
     std::vector<std::thread> threads(world_size.thread);
     std::vector<SimThreadInfo_t> threadInfo(world_size.thread);
+    std::vector<std::vector<int> > cpuSets;
+    if ( cfg.threadPinning != "none" ) {
+        std::string why;
+        cpuSets = threadCpuSets(cfg.threadPinning, world_size.thread, why);
+        if ( cpuSets.empty() ) {
+            g_output.output("WARNING: %s, ignoring --thread-pinning\n", why.c_str());
+        }
+    }
     for ( uint32_t i = 0 ; i < world_size.thread ; i++ ) {
         threadInfo[i].myRank = myRank;
         threadInfo[i].myRank.thread = i;
@@ -667,6 +825,12 @@ main(int argc, char *argv[])
         threadInfo[i].config = &cfg;
         threadInfo[i].graph = graph;
         threadInfo[i].min_part = min_part;
+        if ( !cpuSets.empty() ) {
+            threadInfo[i].cpus = cpuSets[i];
+            std::string cpus;
+            for ( int cpu : cpuSets[i] ) cpus += (cpus.empty() ? "" : ",") + std::to_string(cpu);
+            g_output.verbose(CALL_INFO, 2, 0, "# Thread %" PRIu32 " is bound to CPUs %s\n", i, cpus.c_str());
+        }
     }
 
     double end_serial_build = sst_get_cpu_time();
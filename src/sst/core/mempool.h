@@ -13,12 +13,14 @@
 #define SST_CORE_MEMPOOL_H
 
 #include <list>
-#include <deque>
+#include <vector>
+#include <atomic>
 
 #include <cstddef>
 #include <cstdlib>
 #include <cinttypes>
 #include <cstdint>
+#include <cstring>
 #include <sys/mman.h>
 
 #include "sst/core/threadsafe.h"
@@ -28,40 +30,27 @@ namespace Core {
 
 /**
  * Simple Memory Pool class
+ *
+ * A MemPool is owned by the thread that created it.  Only the owner
+ * allocates from the pool, so the free list needs no locking.
+ * Elements freed by any other thread are pushed onto a lock-free
+ * return list, which the owner reclaims once its free list runs dry.
+ *
+ * The first word of each element is left to the user; the second is
+ * used to link elements on the return list, so elements must be at
+ * least two pointers in size.
  */
 class MemPool
 {
-    template <typename LOCK_t>
-    class FreeList {
-        LOCK_t mtx;
-        std::vector<void*> list;
-    public:
-        inline void insert(void *ptr) {
-            std::lock_guard<LOCK_t> lock(mtx);
-            list.push_back(ptr);
-        }
-
-        inline void* try_remove() {
-            std::lock_guard<LOCK_t> lock(mtx);
-            if ( list.empty() ) return nullptr;
-            void *p = list.back();
-            list.pop_back();
-            return p;
-        }
-
-        size_t size() const { return list.size(); }
-    };
-
-
 public:
     /** Create a new Memory Pool.
      * @param elementSize - Size of each Element
      * @param initialSize - Size of the memory pool (in bytes)
      */
     MemPool(size_t elementSize, size_t initialSize=(2<<20)) :
-        numAlloc(0), numFree(0),
+        numAlloc(0), numFree(0), numReturned(0),
         elemSize(elementSize), arenaSize(initialSize),
-        allocating(false)
+        numArenas(0), owner(threadTag()), returnList(nullptr)
     {
         allocPool();
     }
@@ -69,26 +58,20 @@ public:
     ~MemPool()
     {
         for ( std::list<uint8_t*>::iterator i = arenas.begin() ; i != arenas.end() ; ++i ) {
-            ::free(*i);
+            ::munmap(*i, arenaSize);
         }
     }
 
-    /** Allocate a new element from the memory pool */
+    /** Allocate a new element from the memory pool.  Must only be
+     * called by the thread that created the pool. */
     inline void* malloc()
     {
-        void *ret = freeList.try_remove();
-        while ( !ret ) {
-            bool ok = allocPool();
-            if ( !ok ) return nullptr;
-#if ( defined( __amd64 ) || defined( __amd64__ ) || \
-        defined( __x86_64 ) || defined( __x86_64__ ) )
-            _mm_pause();
-#elif defined(__PPC64__)
-               asm volatile( "or 27, 27, 27" ::: "memory" );
-#endif
-            ret = freeList.try_remove();
+        if ( freeList.empty() && !reclaim() && !allocPool() ) {
+            return nullptr;
         }
-        ++numAlloc;
+        void *ret = freeList.back();
+        freeList.pop_back();
+        numAlloc.store(numAlloc.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
         return ret;
     }
 
@@ -96,11 +79,16 @@ public:
     inline void free(void *ptr)
     {
         // TODO:  Make sure this is in one of our arenas
-        freeList.insert(ptr);
+        if ( owner == threadTag() ) {
+            freeList.push_back(ptr);
+            numFree.store(numFree.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        else {
+            returnFree(ptr);
+        }
 // #ifdef __SST_DEBUG_EVENT_TRACKING__
 //         *((uint64_t*)ptr) = 0xFFFFFFFFFFFFFFFF;
 // #endif
-        ++numFree;
     }
 
     /**
@@ -108,63 +96,95 @@ public:
        overheads are not taken into account.
      */
     uint64_t getBytesMemUsed() {
-        uint64_t bytes_in_arenas = arenas.size() * arenaSize;
+        uint64_t bytes_in_arenas = numArenas.load(std::memory_order_relaxed) * arenaSize;
         uint64_t bytes_in_free_list = freeList.size() * sizeof(void*);
         return bytes_in_arenas + bytes_in_free_list;
     }
 
     uint64_t getUndeletedEntries() {
-        return numAlloc - numFree;
+        return numAlloc.load(std::memory_order_relaxed) -
+            numFree.load(std::memory_order_relaxed) -
+            numReturned.load(std::memory_order_relaxed);
     }
-    
+
     /** Counter:  Number of times elements have been allocated */
     std::atomic<uint64_t> numAlloc;
-    /** Counter:  Number times elements have been freed */
+    /** Counter:  Number times elements have been freed by the owning thread */
     std::atomic<uint64_t> numFree;
+    /** Counter:  Number times elements have been freed by other threads */
+    std::atomic<uint64_t> numReturned;
 
     size_t getArenaSize() const { return arenaSize; }
     size_t getElementSize() const { return elemSize; }
 
     const std::list<uint8_t*>& getArenas() { return arenas; }
-    
+
 private:
 
-    bool allocPool()
+    /** Returns an address unique to the calling thread */
+    static inline const void* threadTag()
     {
-        /* If already in progress, return */
-        if ( allocating.exchange(1, std::memory_order_acquire) ) {
-            return true;
+        static thread_local char tag;
+        return &tag;
+    }
+
+    /** Push an element freed by another thread onto the return list */
+    void returnFree(void *ptr)
+    {
+        void** link = static_cast<void**>(ptr) + 1;
+        void* head = returnList.load(std::memory_order_relaxed);
+        do {
+            *link = head;
+        } while ( !returnList.compare_exchange_weak(head, ptr, std::memory_order_release, std::memory_order_relaxed) );
+        numReturned.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /** Move everything on the return list to the free list.  The
+     * owner takes the whole list at once, so there is no ABA problem.
+     * @return false if nothing was reclaimed */
+    bool reclaim()
+    {
+        void* head = returnList.exchange(nullptr, std::memory_order_acquire);
+        if ( nullptr == head ) return false;
+        while ( head ) {
+            freeList.push_back(head);
+            head = *(static_cast<void**>(head) + 1);
         }
+        return true;
+    }
 
+    bool allocPool()
+    {
         uint8_t *newPool = (uint8_t*)mmap(nullptr, arenaSize, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANON, -1, 0);
         if ( MAP_FAILED == newPool ) {
-            allocating.store(0, std::memory_order_release);
             return false;
         }
-        std::memset(newPool, 0xFF, arenaSize); 
+        std::memset(newPool, 0xFF, arenaSize);
         arenas.push_back(newPool);
+        numArenas.fetch_add(1, std::memory_order_relaxed);
         size_t nelem = arenaSize / elemSize;
-        for ( size_t i = 0 ; i < nelem ; i++ ) {
-            uint64_t* ptr = (uint64_t*)(newPool + (elemSize*i));
+        freeList.reserve(freeList.size() + nelem);
+        // Hand out elements in address order
+        for ( size_t i = nelem ; i > 0 ; i-- ) {
+            uint64_t* ptr = (uint64_t*)(newPool + (elemSize*(i-1)));
 // #ifdef __SST_DEBUG_EVENT_TRACKING__
 //             *ptr = 0xFFFFFFFFFFFFFFFF;
 // #endif
-            freeList.insert(ptr);
-            // freeList.push_back(newPool + (elemSize*i));
+            freeList.push_back(ptr);
         }
-        allocating.store(0, std::memory_order_release);
         return true;
     }
 
     size_t elemSize;
     size_t arenaSize;
 
-    std::atomic<unsigned int> allocating;
-    FreeList<ThreadSafe::Spinlock> freeList;
+    std::atomic<size_t> numArenas;
+    const void* owner;
+    std::vector<void*> freeList;
+    std::atomic<void*> returnList;
     std::list<uint8_t*> arenas;
 
 };
-
 }
 }
 
@@ -0,0 +1,112 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "sst/core/model/binarymodel.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+#include "sst/core/cfgoutput/binaryConfigOutput.h"
+#include "sst/core/params.h"
+#include "sst/core/serialization/serializer.h"
+
+using namespace SST;
+using namespace SST::Core;
+
+SSTBinaryModelDefinition::SSTBinaryModelDefinition(const std::string& fileName, int verbosity, Config* config) :
+    SSTModelDescription(), fileName(fileName), config(config)
+{
+    output = new Output("SSTBinaryModel ", verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTBinaryModelDefinition::~SSTBinaryModelDefinition()
+{
+    delete output;
+    output = nullptr;
+}
+
+ConfigGraph* SSTBinaryModelDefinition::createConfigGraph()
+{
+    typedef BinaryConfigGraphOutput::BinaryConfigHeader Header;
+
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if ( fd < 0 ) {
+        output->fatal(CALL_INFO, 1, "Unable to open %s: %s\n", fileName.c_str(), strerror(errno));
+    }
+    struct stat sb;
+    fstat(fd, &sb);
+    size_t fileSize = sb.st_size;
+    if ( fileSize < sizeof(Header) ) {
+        output->fatal(CALL_INFO, 1, "%s is too small to be a binary configuration\n", fileName.c_str());
+    }
+
+    // Private mapping, nothing is written back
+    char* data = (char*) mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if ( MAP_FAILED == data ) {
+        output->fatal(CALL_INFO, 1, "Unable to map %s: %s\n", fileName.c_str(), strerror(errno));
+    }
+
+    Header header;
+    memcpy(&header, data, sizeof(header));
+    if ( memcmp(header.magic, BinaryConfigGraphOutput::MAGIC, sizeof(header.magic)) ) {
+        output->fatal(CALL_INFO, 1, "%s is not a binary configuration\n", fileName.c_str());
+    }
+    if ( header.version != BinaryConfigGraphOutput::VERSION ) {
+        output->fatal(CALL_INFO, 1, "%s has version %" PRIu32 ", expected %" PRIu32 "\n",
+                      fileName.c_str(), header.version, BinaryConfigGraphOutput::VERSION);
+    }
+    if ( header.size != fileSize - sizeof(header) ) {
+        output->fatal(CALL_INFO, 1, "%s is truncated\n", fileName.c_str());
+    }
+
+    std::vector<std::pair<std::string, std::string>> entries;
+    ConfigGraph* graph = new ConfigGraph();
+
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(data + sizeof(header), header.size);
+    ser & entries;
+    ser & Params::keyMap;
+    ser & Params::keyMapReverse;
+    ser & Params::nextKeyID;
+    ser & *graph;
+
+    munmap(data, fileSize);
+
+    // Apply the program options the original model set.  Writing the
+    // binary configuration again is left to the command line.
+    for ( auto& entry : entries ) {
+        if ( entry.first == "output-binary-config" ) continue;
+        config->setConfigEntryFromModel(entry.first, entry.second);
+    }
+
+    // The stored ranks are exactly what the same partitioner would
+    // produce again, so skip partitioning
+    header.partitioner[sizeof(header.partitioner) - 1] = '\0';
+    if ( header.ranks == config->world_size.rank && header.threads == config->world_size.thread &&
+         config->partitioner == header.partitioner ) {
+        output->verbose(CALL_INFO, 1, 0, "Reusing the %s partition stored in %s\n",
+                        header.partitioner, fileName.c_str());
+        config->partitioner = "sst.self";
+    }
+
+    output->verbose(CALL_INFO, 1, 0, "Loaded %zu components and %zu links from %s\n",
+                    graph->getComponentMap().size(), graph->getLinkMap().size(), fileName.c_str());
+
+    return graph;
+}
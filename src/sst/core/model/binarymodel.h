@@ -0,0 +1,49 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_MODEL_BINARY
+#define SST_CORE_MODEL_BINARY
+
+#include <string>
+
+#include "sst/core/model/sstmodel.h"
+#include "sst/core/config.h"
+#include "sst/core/output.h"
+#include "sst/core/configGraph.h"
+
+namespace SST {
+namespace Core {
+
+/**
+   Loads a ConfigGraph written with --output-binary-config (.sstbin).
+   The file is memory mapped and deserialized in place.  The program
+   options the original model set are applied again, and if the graph
+   was partitioned for the same number of ranks and threads with the
+   partitioner this run asks for, that partition is reused.
+*/
+class SSTBinaryModelDefinition : public SSTModelDescription {
+
+    public:
+        SSTBinaryModelDefinition(const std::string& fileName, int verbosity, Config* config);
+        virtual ~SSTBinaryModelDefinition();
+
+        ConfigGraph* createConfigGraph() override;
+
+    protected:
+        std::string fileName;
+        Output* output;
+        Config* config;
+};
+
+}
+}
+
+#endif
@@ -316,6 +316,14 @@ static PyObject* getSSTMPIWorldSize(PyObject* UNUSED(self), PyObject* UNUSED(arg
     return PyInt_FromLong(ranks);
 }
 
+static PyObject* getSSTMyMPIRank(PyObject* UNUSED(self), PyObject* UNUSED(args)) {
+    int rank = 0;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+#endif
+    return PyInt_FromLong(rank);
+}
+
 static PyObject* getSSTThreadCount(PyObject* UNUSED(self), PyObject* UNUSED(args)) {
     Config *cfg = gModel->getConfig();
     return PyLong_FromLong(cfg->getNumThreads());
@@ -561,6 +569,9 @@ static PyMethodDef sstModuleMethods[] = {
     {   "getMPIRankCount",
         getSSTMPIWorldSize, METH_NOARGS,
         "Gets the number of MPI ranks currently being used to run SST" },
+    {   "getMyMPIRank",
+        getSSTMyMPIRank, METH_NOARGS,
+        "Gets the MPI rank running this copy of the script; with --parallel-load each rank builds only its own components" },
     {   "getThreadCount",
         getSSTThreadCount, METH_NOARGS,
         "Gets the number of MPI ranks currently being used to run SST" },
@@ -614,6 +625,15 @@ void SSTPythonModelDefinition::initModel(const std::string& script_file, int ver
 
     graph = new ConfigGraph();
     nextComponentId = 0;
+#ifdef SST_CONFIG_HAVE_MPI
+    // With a parallel load every rank numbers its own components, so
+    // give each rank its own block of IDs
+    if ( config->parallel_load ) {
+        int rank = 0;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        nextComponentId = (ComponentId_t)rank << PARALLEL_LOAD_ID_BITS;
+    }
+#endif
 
     std::string local_script_name;
     int substr_index = 0;
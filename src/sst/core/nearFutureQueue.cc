@@ -0,0 +1,132 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+
+#include "sst/core/nearFutureQueue.h"
+
+#include <algorithm>
+
+#include "sst/core/output.h"
+#include "sst/core/timeVortex.h"
+
+namespace SST {
+
+const size_t NearFutureQueue::numBuckets;
+
+NearFutureQueue::NearFutureQueue(TimeVortex* tv, const SimTime_t& now, SimTime_t window) :
+    ActivityQueue(),
+    timeVortex(tv),
+    now(now),
+    shift(0),
+    curBucket(0),
+    count(0),
+    insertOrder(0)
+{
+    while ( (static_cast<SimTime_t>(numBuckets) << shift) < window ) shift++;
+    buckets.resize(numBuckets);
+}
+
+NearFutureQueue::~NearFutureQueue()
+{
+    // Activities in NearFutureQueue all need to be deleted
+    for ( auto act : current ) delete act;
+    for ( auto& bucket : buckets ) {
+        for ( auto act : bucket ) delete act;
+    }
+}
+
+void NearFutureQueue::insert(Activity* activity)
+{
+    // Nothing queued, so the ring can be moved up to the present
+    if ( count == 0 ) curBucket = now >> shift;
+
+    if ( !insertNear(activity) ) timeVortex->insert(activity);
+}
+
+void NearFutureQueue::insertBatch(Activity* const* batch, size_t num)
+{
+    if ( count == 0 ) curBucket = now >> shift;
+
+    for ( size_t i = 0; i < num; i++ ) {
+        if ( !insertNear(batch[i]) ) farBatch.push_back(batch[i]);
+    }
+
+    if ( !farBatch.empty() ) {
+        timeVortex->insertBatch(farBatch.data(), farBatch.size());
+        farBatch.clear();
+    }
+}
+
+Activity* NearFutureQueue::pop()
+{
+    if ( count == 0 ) return nullptr;
+    if ( current.empty() ) advance();
+    Activity* ret_val = current.back();
+    current.pop_back();
+    count--;
+    return ret_val;
+}
+
+Activity* NearFutureQueue::front()
+{
+    if ( count == 0 ) return nullptr;
+    if ( current.empty() ) advance();
+    return current.back();
+}
+
+void NearFutureQueue::print(Output &out) const
+{
+    out.output("NearFutureQueue state: %d activities\n", count);
+    for ( auto it = current.rbegin(); it != current.rend(); ++it ) {
+        (*it)->print("  ", out);
+    }
+    for ( size_t i = 1; i < numBuckets; i++ ) {
+        for ( auto act : buckets[(curBucket + i) & (numBuckets - 1)] ) {
+            act->print("  ", out);
+        }
+    }
+}
+
+bool NearFutureQueue::insertNear(Activity* activity)
+{
+    SimTime_t bucket = activity->getDeliveryTime() >> shift;
+
+    if ( bucket == curBucket ) {
+        activity->setQueueOrder(insertOrder++);
+        auto pos = std::upper_bound(current.begin(), current.end(), activity, compare);
+        current.insert(pos, activity);
+    }
+    else if ( bucket > curBucket && bucket - curBucket < numBuckets ) {
+        activity->setQueueOrder(insertOrder++);
+        buckets[bucket & (numBuckets - 1)].push_back(activity);
+    }
+    else {
+        return false;
+    }
+    count++;
+    return true;
+}
+
+void NearFutureQueue::advance()
+{
+    // Only called when current is empty and count is non-zero, so
+    // there is a non-empty bucket somewhere in the ring
+    do {
+        curBucket++;
+    } while ( buckets[curBucket & (numBuckets - 1)].empty() );
+
+    current.swap(buckets[curBucket & (numBuckets - 1)]);
+    std::sort(current.begin(), current.end(), compare);
+}
+
+} // namespace SST
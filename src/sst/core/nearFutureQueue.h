@@ -0,0 +1,101 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_NEARFUTUREQUEUE_H
+#define SST_CORE_NEARFUTUREQUEUE_H
+
+#include <vector>
+
+#include "sst/core/activityQueue.h"
+
+namespace SST {
+
+class Output;
+class TimeVortex;
+
+/**
+ * Queue for events that will be delivered in the near future.
+ *
+ * Events sent on handler links are inserted here instead of directly
+ * into the TimeVortex.  Anything due within the window is appended
+ * to a ring of unsorted time buckets, and only the bucket currently
+ * being delivered is kept sorted.  Anything later is passed on to the
+ * TimeVortex.  Simulation::run() uses before() to interleave the two.
+ */
+class NearFutureQueue : public ActivityQueue {
+public:
+    /**
+     * @param tv - TimeVortex that handles activities beyond the window
+     * @param now - Current simulated time of the owning Simulation
+     * @param window - Size of the window in core time; rounded up to
+     * a multiple of the number of buckets
+     */
+    NearFutureQueue(TimeVortex* tv, const SimTime_t& now, SimTime_t window);
+    ~NearFutureQueue();
+
+    bool empty() override { return count == 0; }
+    int size() override { return count; }
+    void insert(Activity* activity) override;
+    void insertBatch(Activity* const* batch, size_t num) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    /** Returns true if the next activity in this queue should be
+     * delivered before act */
+    inline bool before(Activity* act) {
+        if ( count == 0 ) return false;
+        if ( current.empty() ) advance();
+        // Ties with the TimeVortex can only come from an earlier send
+        // on the same link, so the TimeVortex wins them.
+        return Activity::less_time_priority_order()(act, current.back());
+    }
+
+    /** Print the state of the queue */
+    void print(Output &out) const;
+
+private:
+#ifdef SST_ENFORCE_EVENT_ORDERING
+    typedef Activity::pq_less_time_priority_order compare_t;
+#else
+    typedef Activity::pq_less_time_priority compare_t;
+#endif
+    typedef std::vector<Activity*> bucket_t;
+
+    static const size_t numBuckets = 256;
+
+    /** Insert an activity if it falls within the window.
+     * @return false if the activity belongs in the TimeVortex */
+    bool insertNear(Activity* activity);
+    /** Load the next non-empty bucket into current */
+    void advance();
+
+    compare_t compare;
+
+    TimeVortex* timeVortex;
+    const SimTime_t& now;
+    /* log2 of the width of each bucket */
+    unsigned int shift;
+
+    /* Bucket number (time >> shift) whose contents are in current */
+    SimTime_t curBucket;
+    /* Sorted latest first so the next activity is at the back */
+    bucket_t current;
+    std::vector<bucket_t> buckets;
+    /* Activities from a batch that are beyond the window */
+    bucket_t farBatch;
+
+    int count;
+    uint64_t insertOrder;
+};
+
+} //namespace SST
+
+#endif // SST_CORE_NEARFUTUREQUEUE_H
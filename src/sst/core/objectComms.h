@@ -223,6 +223,44 @@ void all_gather(dataType& data, std::vector<dataType> &out_data) {
 }
 
 
+/**
+   Personalized exchange: send_data[i] is sent to rank i and the object
+   rank i sent to this rank is returned in recv_data[i].
+*/
+template <typename dataType>
+void all_to_allv(std::vector<dataType> &send_data, std::vector<dataType> &recv_data) {
+    int world = 0;
+    MPI_Comm_size(MPI_COMM_WORLD, &world);
+
+    std::vector<int> sendSizes(world), sendDispl(world);
+    std::vector<char> sendBuff;
+    for ( int i = 0 ; i < world ; i++ ) {
+        std::vector<char> buffer = Comms::serialize(send_data[i]);
+        sendDispl[i] = sendBuff.size();
+        sendSizes[i] = buffer.size();
+        sendBuff.insert(sendBuff.end(), buffer.begin(), buffer.end());
+    }
+
+    std::vector<int> recvSizes(world), recvDispl(world);
+    MPI_Alltoall(sendSizes.data(), 1, MPI_INT, recvSizes.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+    int totalBuf = 0;
+    for ( int i = 0 ; i < world ; i++ ) {
+        recvDispl[i] = totalBuf;
+        totalBuf += recvSizes[i];
+    }
+
+    std::vector<char> recvBuff(totalBuf);
+    MPI_Alltoallv(sendBuff.data(), sendSizes.data(), sendDispl.data(), MPI_BYTE,
+            recvBuff.data(), recvSizes.data(), recvDispl.data(), MPI_BYTE, MPI_COMM_WORLD);
+
+    recv_data.resize(world);
+    for ( int i = 0 ; i < world ; i++ ) {
+        Comms::deserialize(&recvBuff[recvDispl[i]], recvSizes[i], recv_data[i]);
+    }
+}
+
+
 
 
 #endif
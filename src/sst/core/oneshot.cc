@@ -15,6 +15,7 @@
 
 #include "sst/core/simulation.h"
 #include "sst/core/timeConverter.h"
+#include "sst/core/timeVortex.h"
 
 
 namespace SST {
@@ -79,15 +80,16 @@ SimTime_t OneShot::scheduleOneShot()
 {
     // Add an event in the future into the TimeVortex for when 
     // the OneShot should Fire.
-    Simulation* sim = Simulation::getSimulation();
+    const SimulationContext& ctx = Simulation::getContext();
 
     // Figure out what the next time should be for when the OneShot should fire 
-    SimTime_t nextEventTime = sim->getCurrentSimCycle() + m_timeDelay->getFactor();
+    SimTime_t nextEventTime = *ctx.currentSimCycle + m_timeDelay->getFactor();
 
-//    std::cout << "OneShot (scheduleOneShot) " << m_timeDelay->getFactor() << " Scheduling; target cycle = " << nextEventTime << " current cycle = " << sim->getCurrentSimCycle() << std::endl;
+//    std::cout << "OneShot (scheduleOneShot) " << m_timeDelay->getFactor() << " Scheduling; target cycle = " << nextEventTime << " current cycle = " << *ctx.currentSimCycle << std::endl;
 
     // Add this one shot to the Activity queue, and mark this OneShot at scheduled 
-    sim->insertActivity(nextEventTime, this);
+    setDeliveryTime(nextEventTime);
+    ctx.timeVortex->insert(this);
     m_scheduled = true;
     
     return nextEventTime;
@@ -100,10 +102,8 @@ void OneShot::execute(void)
     OneShot::HandlerBase* handler;
     HandlerList_t*        ptrHandlerList;
 
-    Simulation* sim = Simulation::getSimulation();
-    
     // Figure out the current sim time 
-    SimTime_t currentEventTime = sim->getCurrentSimCycle();
+    SimTime_t currentEventTime = *Simulation::getContext().currentSimCycle;
     
 //    std::cout << "OneShot (execute) #" << m_timeDelay->getFactor() << " Executing; At current Event cycle = " << currentEventTime << std::endl;
     
@@ -34,6 +34,10 @@ int main(int argc, char *argv[]);
 namespace SST {
 
 class ConfigGraph;
+namespace Core {
+class BinaryConfigGraphOutput;
+class SSTBinaryModelDefinition;
+}
 
 /**
  * Parameter store.
@@ -473,6 +477,9 @@ private:
 
     /* Friend main() because it broadcasts the maps */
     friend int ::main(int argc, char *argv[]);
+    /* Binary configuration files store the maps */
+    friend class SST::Core::BinaryConfigGraphOutput;
+    friend class SST::Core::SSTBinaryModelDefinition;
 
     static std::map<std::string, uint32_t> keyMap;
     static std::vector<std::string> keyMapReverse;
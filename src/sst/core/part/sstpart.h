@@ -13,6 +13,7 @@
 #ifndef SST_CORE_PART_BASE
 #define SST_CORE_PART_BASE
 
+#include "sst/core/sst_types.h"
 #include "sst/core/rankInfo.h"
 #include "sst/core/warnmacros.h"
 #include "sst/core/eli/elementinfo.h"
@@ -23,6 +24,7 @@ namespace SST {
 
 class ConfigGraph;
 class PartitionGraph;
+class PartitionLink;
 
 namespace Partition {
 
@@ -37,7 +39,7 @@ public:
     SST_ELI_DECLARE_DEFAULT_INFO_EXTERN()
     SST_ELI_DECLARE_CTOR_EXTERN(RankInfo,RankInfo,int)
 
-    SSTPartitioner() {}
+    SSTPartitioner() : latency_threshold(0) {}
     virtual ~SSTPartitioner() {}
     
     /** Function to be overridden by subclasses
@@ -65,6 +67,18 @@ public:
     virtual bool spawnOnAllRanks() { return false; }
     // virtual bool supportsPartialPartitionInput() { return false; }
 
+    /** Set the latency below which links should not be cut.  The
+     * lowest latency cut between ranks or threads is how far they
+     * can run ahead between syncs.  0 turns this off. */
+    void setLatencyThreshold(SimTime_t threshold) { latency_threshold = threshold; }
+
+protected:
+    /** Cost of cutting link for partitioners that weigh links: 1, or
+     * more than cutting all num_links links when its latency is below
+     * the threshold */
+    int64_t getCutCost(const PartitionLink& link, size_t num_links) const;
+
+    SimTime_t latency_threshold;
 
 };
 
@@ -39,10 +39,13 @@ SimTime_t RankSyncParallelSkip::myNextSyncTime = 0;
 
 ///// RankSyncParallelSkip class /////
     
-RankSyncParallelSkip::RankSyncParallelSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC)) :
+RankSyncParallelSkip::RankSyncParallelSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC), bool nonblockingReduce) :
     NewRankSync(),
     mpiWaitTime(0.0),
     deserializeTime(0.0),
+    nonblockingReduce(nonblockingReduce),
+    reducePending(false),
+    skipExchange(false),
     send_count(0),
     serializeReadyBarrier(num_ranks.thread),
     slaveExchangeDoneBarrier(num_ranks.thread),
@@ -50,7 +53,8 @@ RankSyncParallelSkip::RankSyncParallelSkip(RankInfo num_ranks, TimeConverter* UN
 {
     // TraceFunction(CALL_INFO_LONG);
     max_period = Simulation::getSimulation()->getMinPartTC();
-    myNextSyncTime = max_period->getFactor();
+    // Not zero when restarting from a checkpoint
+    myNextSyncTime = Simulation::getSimulation()->getCurrentSimCycle() + max_period->getFactor();
     recv_count = new int[num_ranks.thread];
     for ( uint32_t i = 0; i < num_ranks.thread; i++ ) {
         recv_count[i] = 0;
@@ -129,6 +133,8 @@ RankSyncParallelSkip::finalizeLinkConfigurations() {
 
 void
 RankSyncParallelSkip::prepareForComplete() {
+    if ( reducePending ) completeReduce();
+
     for (link_map_t::iterator i = link_map.begin() ; i != link_map.end() ; ++i) {
         prepareForCompleteInt(i->second);
     }
@@ -152,16 +158,41 @@ RankSyncParallelSkip::execute(int thread)
 {
     // TraceFunction trace(CALL_INFO_LONG);
     if ( thread == 0 ) {
-        exchange_master(thread);
+        skipExchange = reducePending && completeReduce();
+        if ( skipExchange ) serializeReadyBarrier.wait(); /* Release slaves */
+        else exchange_master(thread);
         allDoneBarrier.wait(); /* Sync up with slave finish below */
     }
     else {
         serializeReadyBarrier.wait(); /* Wait for exchange_master() to start up */
-        exchange_slave(thread); /* Waits at the end */
+        if ( !skipExchange ) exchange_slave(thread); /* Waits at the end */
         allDoneBarrier.wait(); /* Wait for exchange_master to finish */
     }
 }
 
+bool
+RankSyncParallelSkip::completeReduce()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Wait(&reduceReq, MPI_STATUS_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    reducePending = false;
+
+    // The exit status is as of the last exchange, so the run ends one
+    // sync after the last reference goes, at the same end time
+    Simulation::getSimulation()->getExit()->setGlobalStatus(reduceOutput[1] ? 0 : 1, MAX_SIMTIME_T - reduceOutput[2]);
+
+    // If nothing on any rank was due before now, nothing can have
+    // been sent since the last exchange and we can skip ahead.
+    if ( reduceOutput[0] > Simulation::getSimulation()->getCurrentSimCycle() ) {
+        myNextSyncTime = reduceOutput[0] + max_period->getFactor();
+        return true;
+    }
+#endif
+    return false;
+}
+
 void
 RankSyncParallelSkip::exchange_slave(int thread)
 {
@@ -339,6 +370,20 @@ RankSyncParallelSkip::exchange_master(int UNUSED(thread))
     // Need to get the local minimum, then do a global minimum
     // SimTime_t input = Simulation::getSimulation()->getNextActivityTime();
     SimTime_t input = Simulation::getLocalMinimumNextActivityTime();
+
+    if ( nonblockingReduce ) {
+        // The result isn't needed until the next sync, which can't be
+        // more than one period away without it.
+        Exit* exit = Simulation::getSimulation()->getExit();
+        reduceInput[0] = input;
+        reduceInput[1] = ( exit->getRefCount() == 0 );
+        reduceInput[2] = MAX_SIMTIME_T - exit->getEndTime();
+        MPI_Iallreduce( reduceInput, reduceOutput, 3, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &reduceReq );
+        reducePending = true;
+        myNextSyncTime = Simulation::getSimulation()->getCurrentSimCycle() + max_period->getFactor();
+        return;
+    }
+
     SimTime_t min_time;
     MPI_Allreduce( &input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD );
 
@@ -418,11 +463,8 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
             buffer = i->second.rbuf;
         }
 
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header));
-        
         std::vector<Activity*> activities;
-        ser & activities;
+        SyncQueue::unpackData(buffer, activities);
 
         for ( unsigned int j = 0; j < activities.size(); j++ ) {
             
@@ -455,16 +497,9 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
 void
 RankSyncParallelSkip::deserializeMessage(comm_recv_pair* msg)
 {
-    char* buffer = msg->rbuf;
-    SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(buffer);
-    unsigned int size = hdr->buffer_size;
-    
     auto deserialStart = SST::Core::Profile::now();
 
-    SST::Core::Serialization::serializer ser;
-    
-    ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header));
-    ser & msg->activity_vec;
+    SyncQueue::unpackData(msg->rbuf, msg->activity_vec);
 
     deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
 }
@@ -32,8 +32,13 @@ class TimeConverter;
 
 class RankSyncParallelSkip : public NewRankSync {
 public:
-    /** Create a new Sync object which fires with a specified period */
-    RankSyncParallelSkip(RankInfo num_ranks, TimeConverter* minPartTC);
+    /** Create a new Sync object which fires with a specified period
+     * @param num_ranks - Number of ranks and threads
+     * @param minPartTC - Minimum partition latency
+     * @param nonblockingReduce - Compute the next sync time with a
+     * non-blocking reduction that completes at the next sync
+     */
+    RankSyncParallelSkip(RankInfo num_ranks, TimeConverter* minPartTC, bool nonblockingReduce);
     virtual ~RankSyncParallelSkip();
     
     /** Register a Link which this Sync Object is responsible for */
@@ -48,6 +53,7 @@ public:
     void prepareForComplete() override;
 
     SimTime_t getNextSyncTime() override { return myNextSyncTime; }
+    bool checksExit() override { return nonblockingReduce; }
     
     uint64_t getDataSize() const override;
     
@@ -58,6 +64,11 @@ private:
     // Function that actually does the exchange during run
     void exchange_master(int thread);
     void exchange_slave(int thread);
+    /** Complete the reduction started by the last exchange.
+     * @return true if no rank has had any activity since then, in
+     * which case the next sync time has been moved and there is
+     * nothing to exchange */
+    bool completeReduce();
     
     struct comm_send_pair {
         RankInfo to_rank;
@@ -90,6 +101,18 @@ private:
     double mpiWaitTime;
     double deserializeTime;
 
+    bool nonblockingReduce;
+    bool reducePending;
+    /* Set by thread 0 when the exchange is skipped */
+    bool skipExchange;
+    /* The next activity time, whether every Exit reference is gone
+     * and the complement of the end time, all reduced with MPI_MIN */
+    SimTime_t reduceInput[3];
+    SimTime_t reduceOutput[3];
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Request reduceReq;
+#endif
+
     int* recv_count;
     int send_count;
 
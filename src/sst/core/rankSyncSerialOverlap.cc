@@ -0,0 +1,353 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "sst/core/rankSyncSerialOverlap.h"
+
+#include "sst/core/event.h"
+#include "sst/core/exit.h"
+#include "sst/core/link.h"
+#include "sst/core/simulation.h"
+#include "sst/core/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/profile.h"
+
+#ifdef SST_CONFIG_HAVE_MPI
+#define UNUSED_WO_MPI(x) x
+#else
+#define UNUSED_WO_MPI(x) UNUSED(x)
+#endif
+
+
+namespace SST {
+
+// Static Data Members
+SimTime_t RankSyncSerialOverlap::myNextSyncTime = 0;
+
+
+RankSyncSerialOverlap::RankSyncSerialOverlap(RankInfo num_ranks, TimeConverter* minPartTC) :
+    NewRankSync(),
+    pending(false),
+    mpiWaitTime(0.0),
+    deserializeTime(0.0),
+    exchangeBarrier(num_ranks.thread)
+{
+    max_period = minPartTC;
+    period = max_period->getFactor() / 2;
+    if ( period == 0 ) {
+        Simulation::getSimulationOutput().fatal(CALL_INFO, 1,
+            "Overlapped rank sync needs a minimum partition latency of at least two core time units\n");
+    }
+    myNextSyncTime = Simulation::getSimulation()->getCurrentSimCycle() + period;
+    deliver.resize(num_ranks.thread);
+}
+
+RankSyncSerialOverlap::~RankSyncSerialOverlap()
+{
+    for (comm_map_t::iterator i = comm_map.begin() ; i != comm_map.end() ; ++i) {
+        delete i->second.squeue;
+        delete[] i->second.rbuf;
+    }
+    comm_map.clear();
+
+    for (link_map_t::iterator i = link_map.begin() ; i != link_map.end() ; ++i) {
+        delete i->second.link;
+    }
+    link_map.clear();
+
+    if ( mpiWaitTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(CALL_INFO, 1, 0, "RankSyncSerialOverlap mpiWait: %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime, deserializeTime);
+}
+
+ActivityQueue* RankSyncSerialOverlap::registerLink(const RankInfo& to_rank, const RankInfo& from_rank, LinkId_t link_id, Link* link)
+{
+    SyncQueue* queue;
+    if ( comm_map.count(to_rank.rank) == 0 ) {
+        queue = comm_map[to_rank.rank].squeue = new SyncQueue();
+        comm_map[to_rank.rank].rbuf = new char[4096];
+        comm_map[to_rank.rank].local_size = 4096;
+        comm_map[to_rank.rank].remote_size = 4096;
+    } else {
+        queue = comm_map[to_rank.rank].squeue;
+    }
+
+    link_map[link_id].link = link;
+    link_map[link_id].thread = from_rank.thread;
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+    link->setSendingComponentInfo("SYNC", "SYNC", "");
+#endif
+    return queue;
+}
+
+void
+RankSyncSerialOverlap::finalizeLinkConfigurations() {
+    for (link_map_t::iterator i = link_map.begin() ; i != link_map.end() ; ++i) {
+        finalizeConfiguration(i->second.link);
+    }
+}
+
+void
+RankSyncSerialOverlap::prepareForComplete() {
+    // Everything still in flight is due after the end of simulation,
+    // but the requests need to be completed before the untimed
+    // exchanges of the complete() stage reuse the tags.
+    completeExchange();
+    for ( auto& vec : deliver ) {
+        for ( auto& item : vec ) delete item.second;
+        vec.clear();
+    }
+
+    for (link_map_t::iterator i = link_map.begin() ; i != link_map.end() ; ++i) {
+        prepareForCompleteInt(i->second.link);
+    }
+}
+
+uint64_t
+RankSyncSerialOverlap::getDataSize() const {
+    size_t count = 0;
+    for ( comm_map_t::const_iterator it = comm_map.begin();
+          it != comm_map.end(); ++it ) {
+        count += (it->second.squeue->getDataSize() + it->second.local_size);
+    }
+    return count;
+}
+
+void
+RankSyncSerialOverlap::execute(int thread)
+{
+    if ( thread == 0 ) {
+        completeExchange();
+        startExchange();
+        myNextSyncTime += period;
+    }
+
+    exchangeBarrier.wait();
+
+    // Each thread delivers the events for the links it owns
+    std::vector<std::pair<Link*, Event*> >& events = deliver[thread];
+    SimTime_t current_cycle = Simulation::getSimulation()->getCurrentSimCycle();
+    for ( auto& item : events ) {
+        Event* ev = item.second;
+        if ( ev->getDeliveryTime() < current_cycle ) {
+            Simulation::getSimulationOutput().fatal(CALL_INFO, 1,
+                "Event received for time %" PRIu64 " at time %" PRIu64 ", the sync window is larger than the link latency\n",
+                ev->getDeliveryTime(), current_cycle);
+        }
+        // Need to figure out what the "delay" is for this event.
+        SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+        item.first->send(delay, ev);
+    }
+    events.clear();
+}
+
+void
+RankSyncSerialOverlap::completeExchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( !pending ) return;
+
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreqs.size(), rreqs.data(), MPI_STATUSES_IGNORE);
+    MPI_Wait(&exitReq, MPI_STATUS_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    // The exit status is as of the last sync, so the run ends one
+    // sync after the last reference goes, at the same end time
+    Simulation::getSimulation()->getExit()->setGlobalStatus(exitOutput[0] ? 0 : 1, MAX_SIMTIME_T - exitOutput[1]);
+
+    std::vector<Activity*> activities;
+    for (comm_map_t::iterator i = comm_map.begin() ; i != comm_map.end() ; ++i) {
+        // Get the buffer and deserialize all the events
+        char* buffer = i->second.rbuf;
+
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(buffer);
+        unsigned int size = hdr->buffer_size;
+        int mode = hdr->mode;
+
+        if ( mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf = new char[size];
+                i->second.local_size = size;
+            }
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE,
+                     i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            buffer = i->second.rbuf;
+        }
+
+        auto deserialStart = SST::Core::Profile::now();
+
+        SyncQueue::unpackData(buffer, activities);
+
+        for ( auto act : activities ) {
+            Event* ev = static_cast<Event*>(act);
+            link_map_t::iterator link = link_map.find(ev->getLinkId());
+            if (link == link_map.end()) {
+                Simulation::getSimulationOutput().fatal(CALL_INFO,1,"Link not found in map!\n");
+            } else {
+                deliver[link->second.thread].emplace_back(link->second.link, ev);
+            }
+        }
+        activities.clear();
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+    }
+
+    // The send buffers are reused by the next exchange
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreqs.size(), sreqs.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    sreqs.clear();
+    rreqs.clear();
+    pending = false;
+#endif
+}
+
+void
+RankSyncSerialOverlap::startExchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    for (comm_map_t::iterator i = comm_map.begin() ; i != comm_map.end() ; ++i) {
+
+        // Do all the sends
+        // Get the buffer from the syncQueue
+        char* send_buffer = i->second.squeue->getData();
+        // Cast to Header so we can get/fill in data
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int tag = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            sreqs.emplace_back();
+            MPI_Isend(send_buffer, sizeof(SyncQueue::Header), MPI_BYTE,
+                      i->first/*dest*/, tag, MPI_COMM_WORLD, &sreqs.back());
+            i->second.remote_size = hdr->buffer_size;
+            tag = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        sreqs.emplace_back();
+        MPI_Isend(send_buffer, hdr->buffer_size, MPI_BYTE,
+                  i->first/*dest*/, tag, MPI_COMM_WORLD, &sreqs.back());
+
+        // Post all the receives
+        rreqs.emplace_back();
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE,
+                  i->first, 1, MPI_COMM_WORLD, &rreqs.back());
+    }
+
+    Exit* exit = Simulation::getSimulation()->getExit();
+    exitInput[0] = ( exit->getRefCount() == 0 );
+    exitInput[1] = MAX_SIMTIME_T - exit->getEndTime();
+    MPI_Iallreduce( exitInput, exitOutput, 2, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &exitReq );
+    pending = true;
+#endif
+}
+
+void
+RankSyncSerialOverlap::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atomic<int>& UNUSED_WO_MPI(msg_count))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( thread != 0 ) {
+        return;
+    }
+    // Maximum number of outstanding requests is 3 times the number of
+    // ranks I communicate with (1 recv, 2 sends per rank)
+    MPI_Request sreqs[2 * comm_map.size()];
+    MPI_Request rreqs[comm_map.size()];
+    int rreq_count = 0;
+    int sreq_count = 0;
+
+    for (comm_map_t::iterator i = comm_map.begin() ; i != comm_map.end() ; ++i) {
+
+        // Do all the sends
+        // Get the buffer from the syncQueue
+        char* send_buffer = i->second.squeue->getData();
+        // Cast to Header so we can get/fill in data
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int tag = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first/*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+            i->second.remote_size = hdr->buffer_size;
+            tag = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(send_buffer, hdr->buffer_size, MPI_BYTE, i->first/*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+
+        // Post all the receives
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+
+    }
+
+    // Wait for all recvs to complete
+    MPI_Waitall(rreq_count, rreqs, MPI_STATUSES_IGNORE);
+
+
+    for (comm_map_t::iterator i = comm_map.begin() ; i != comm_map.end() ; ++i) {
+
+        // Get the buffer and deserialize all the events
+        char* buffer = i->second.rbuf;
+
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(buffer);
+        unsigned int size = hdr->buffer_size;
+        int mode = hdr->mode;
+
+        if ( mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf = new char[size];
+                i->second.local_size = size;
+            }
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            buffer = i->second.rbuf;
+        }
+
+        std::vector<Activity*> activities;
+        SyncQueue::unpackData(buffer, activities);
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event* ev = static_cast<Event*>(activities[j]);
+            link_map_t::iterator link = link_map.find(ev->getLinkId());
+            if (link == link_map.end()) {
+                Simulation::getSimulationOutput().fatal(CALL_INFO,1,"Link not found in map!\n");
+            } else {
+                sendUntimedData_sync(link->second.link,ev);
+            }
+        }
+    }
+
+    // Clear the SyncQueues used to send the data after all the sends have completed
+    MPI_Waitall(sreq_count, sreqs, MPI_STATUSES_IGNORE);
+
+    for (comm_map_t::iterator i = comm_map.begin() ; i != comm_map.end() ; ++i) {
+        i->second.squeue->clear();
+    }
+
+    // Do an allreduce to see if there were any messages sent
+    int input = msg_count;
+
+    int count;
+    MPI_Allreduce( &input, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD );
+    msg_count = count;
+#endif
+}
+
+} // namespace SST
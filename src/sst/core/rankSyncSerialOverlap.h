@@ -0,0 +1,122 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_RANKSYNCSERIALOVERLAP_H
+#define SST_CORE_RANKSYNCSERIALOVERLAP_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/syncManager.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
+
+#include <map>
+#include <vector>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+class SyncQueue;
+class TimeConverter;
+
+/**
+ * Rank sync that overlaps the exchange with event processing.
+ *
+ * The sync fires every half of the minimum cross-partition latency.
+ * An event sent during the window ending at sync N cannot be
+ * delivered before sync N+1, so the exchange for window N is only
+ * started at sync N and completed at sync N+1, while the events of
+ * window N+1 execute.  Thread 0 drives all of the MPI traffic; the
+ * received events are handed to the threads that own their links.
+ */
+class RankSyncSerialOverlap : public NewRankSync {
+public:
+    /** Create a new Sync object which fires with a specified period */
+    RankSyncSerialOverlap(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncSerialOverlap();
+
+    /** Register a Link which this Sync Object is responsible for */
+    ActivityQueue* registerLink(const RankInfo& to_rank, const RankInfo& from_rank, LinkId_t link_id, Link* link) override;
+    void execute(int thread) override;
+
+    /** Cause an exchange of Untimed Data to occur */
+    void exchangeLinkUntimedData(int thread, std::atomic<int>& msg_count) override;
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override;
+    /** Prepare for the complete() stage */
+    void prepareForComplete() override;
+
+    SimTime_t getNextSyncTime() override { return myNextSyncTime; }
+    bool checksExit() override { return true; }
+
+    uint64_t getDataSize() const override;
+
+private:
+
+    static SimTime_t myNextSyncTime;
+
+    /** Wait for the exchange started at the last sync and sort the
+     * received events by the thread that owns their link */
+    void completeExchange();
+    /** Send everything queued since the last sync and post the
+     * receives for it */
+    void startExchange();
+
+    struct comm_pair {
+        SyncQueue* squeue; // SyncQueue
+        char* rbuf; // receive buffer
+        uint32_t local_size;
+        uint32_t remote_size;
+    };
+
+    struct link_info {
+        Link* link;
+        uint32_t thread;
+    };
+
+    typedef std::map<int, comm_pair > comm_map_t;
+    typedef std::map<LinkId_t, link_info> link_map_t;
+
+    comm_map_t comm_map;
+    link_map_t link_map;
+
+    /* Sync period, half the minimum partition latency */
+    SimTime_t period;
+    /* True while an exchange is in flight */
+    bool pending;
+
+    /* Whether every Exit reference is gone and the complement of the
+     * end time, both reduced with MPI_MIN alongside the exchange */
+    SimTime_t exitInput[2];
+    SimTime_t exitOutput[2];
+
+#ifdef SST_CONFIG_HAVE_MPI
+    std::vector<MPI_Request> sreqs;
+    std::vector<MPI_Request> rreqs;
+    MPI_Request exitReq;
+#endif
+
+    /* Received events and their links, indexed by local thread */
+    std::vector<std::vector<std::pair<Link*, Event*> > > deliver;
+
+    double mpiWaitTime;
+    double deserializeTime;
+
+    Core::ThreadSafe::Barrier exchangeBarrier;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_RANKSYNCSERIALOVERLAP_H
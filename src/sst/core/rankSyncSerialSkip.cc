@@ -39,13 +39,16 @@ namespace SST {
 SimTime_t RankSyncSerialSkip::myNextSyncTime = 0;
 
 
-RankSyncSerialSkip::RankSyncSerialSkip(TimeConverter* UNUSED(minPartTC)) :
+RankSyncSerialSkip::RankSyncSerialSkip(TimeConverter* UNUSED(minPartTC), bool nonblockingReduce) :
     NewRankSync(),
     mpiWaitTime(0.0),
-    deserializeTime(0.0)
+    deserializeTime(0.0),
+    nonblockingReduce(nonblockingReduce),
+    reducePending(false)
 {
     max_period = Simulation::getSimulation()->getMinPartTC();
-    myNextSyncTime = max_period->getFactor();
+    // Not zero when restarting from a checkpoint
+    myNextSyncTime = Simulation::getSimulation()->getCurrentSimCycle() + max_period->getFactor();
 }
 
 RankSyncSerialSkip::~RankSyncSerialSkip()
@@ -92,6 +95,8 @@ RankSyncSerialSkip::finalizeLinkConfigurations() {
 
 void
 RankSyncSerialSkip::prepareForComplete() {
+    if ( reducePending ) completeReduce();
+
     for (link_map_t::iterator i = link_map.begin() ; i != link_map.end() ; ++i) {
         prepareForCompleteInt(i->second);
     }
@@ -111,10 +116,34 @@ void
 RankSyncSerialSkip::execute(int thread)
 {
     if ( thread == 0 ) {
+        if ( reducePending && completeReduce() ) return;
         exchange();
     }
 }
 
+bool
+RankSyncSerialSkip::completeReduce()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Wait(&reduceReq, MPI_STATUS_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+    reducePending = false;
+
+    // The exit status is as of the last exchange, so the run ends one
+    // sync after the last reference goes, at the same end time
+    Simulation::getSimulation()->getExit()->setGlobalStatus(reduceOutput[1] ? 0 : 1, MAX_SIMTIME_T - reduceOutput[2]);
+
+    // If nothing on any rank was due before now, nothing can have
+    // been sent since the last exchange and we can skip ahead.
+    if ( reduceOutput[0] > Simulation::getSimulation()->getCurrentSimCycle() ) {
+        myNextSyncTime = reduceOutput[0] + max_period->getFactor();
+        return true;
+    }
+#endif
+    return false;
+}
+
 void
 RankSyncSerialSkip::exchange(void)
 {
@@ -186,12 +215,8 @@ RankSyncSerialSkip::exchange(void)
         
         auto deserialStart = SST::Core::Profile::now();
 
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header));
-
         std::vector<Activity*> activities;
-        activities.clear();
-        ser & activities;
+        SyncQueue::unpackData(buffer, activities);
         
         deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
 
@@ -231,6 +256,20 @@ RankSyncSerialSkip::exchange(void)
     // Need to get the local minimum, then do a global minimum
     // SimTime_t input = Simulation::getSimulation()->getNextActivityTime();
     SimTime_t input = Simulation::getLocalMinimumNextActivityTime();
+
+    if ( nonblockingReduce ) {
+        // The result isn't needed until the next sync, which can't be
+        // more than one period away without it.
+        Exit* exit = Simulation::getSimulation()->getExit();
+        reduceInput[0] = input;
+        reduceInput[1] = ( exit->getRefCount() == 0 );
+        reduceInput[2] = MAX_SIMTIME_T - exit->getEndTime();
+        MPI_Iallreduce( reduceInput, reduceOutput, 3, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD, &reduceReq );
+        reducePending = true;
+        myNextSyncTime = current_cycle + max_period->getFactor();
+        return;
+    }
+
     SimTime_t min_time;
     MPI_Allreduce( &input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD );
 
@@ -302,11 +341,8 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
             buffer = i->second.rbuf;
         }
         
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)],size-sizeof(SyncQueue::Header));
-        
         std::vector<Activity*> activities;
-        ser & activities;
+        SyncQueue::unpackData(buffer, activities);
         for ( unsigned int j = 0; j < activities.size(); j++ ) {
             
             Event* ev = static_cast<Event*>(activities[j]);
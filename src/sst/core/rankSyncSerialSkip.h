@@ -15,9 +15,16 @@
 #include "sst/core/sst_types.h"
 #include "sst/core/syncManager.h"
 #include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
 
 #include <map>
 
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
 namespace SST {
 
 class SyncQueue;
@@ -25,8 +32,12 @@ class TimeConverter;
 
 class RankSyncSerialSkip : public NewRankSync {
 public:
-    /** Create a new Sync object which fires with a specified period */
-    RankSyncSerialSkip(TimeConverter* minPartTC);
+    /** Create a new Sync object which fires with a specified period
+     * @param minPartTC - Minimum partition latency
+     * @param nonblockingReduce - Compute the next sync time with a
+     * non-blocking reduction that completes at the next sync
+     */
+    RankSyncSerialSkip(TimeConverter* minPartTC, bool nonblockingReduce);
     virtual ~RankSyncSerialSkip();
     
     /** Register a Link which this Sync Object is responsible for */
@@ -41,6 +52,7 @@ public:
     void prepareForComplete() override;
 
     SimTime_t getNextSyncTime() override { return myNextSyncTime; }
+    bool checksExit() override { return nonblockingReduce; }
     
     uint64_t getDataSize() const override;
     
@@ -50,6 +62,11 @@ private:
 
     // Function that actually does the exchange during run
     void exchange();
+    /** Complete the reduction started by the last exchange.
+     * @return true if no rank has had any activity since then, in
+     * which case the next sync time has been moved and there is
+     * nothing to exchange */
+    bool completeReduce();
     
     struct comm_pair {
         SyncQueue* squeue; // SyncQueue
@@ -68,6 +85,15 @@ private:
     double mpiWaitTime;
     double deserializeTime;
 
+    bool nonblockingReduce;
+    bool reducePending;
+    /* The next activity time, whether every Exit reference is gone
+     * and the complement of the end time, all reduced with MPI_MIN */
+    SimTime_t reduceInput[3];
+    SimTime_t reduceOutput[3];
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Request reduceReq;
+#endif
 };
 
 } // namespace SST
@@ -14,6 +14,9 @@
 #include "sst/core/simulation.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <utility>
 
 #include "sst/core/clock.h"
@@ -22,8 +25,10 @@
 #include "sst/core/heartbeat.h"
 #include "sst/core/exit.h"
 #include "sst/core/factory.h"
+#include "sst/core/link.h"
 #include "sst/core/linkMap.h"
 #include "sst/core/linkPair.h"
+#include "sst/core/nearFutureQueue.h"
 #include "sst/core/sharedRegionImpl.h"
 #include "sst/core/output.h"
 #include "sst/core/stopAction.h"
@@ -44,6 +49,36 @@ using namespace SST::Statistics;
 
 namespace SST {
 
+namespace {
+
+const char CHECKPOINT_MAGIC[8] = { 'S', 'S', 'T', 'C', 'K', 'P', 'T', '\0' };
+const uint32_t CHECKPOINT_VERSION = 1;
+
+/* Starts each checkpoint file, followed by the serialized state */
+struct CheckpointHeader {
+    char     magic[8];
+    uint32_t version;
+    /** Number of the checkpoint, counting from 0 */
+    uint32_t index;
+    uint32_t rank;
+    uint32_t thread;
+    uint32_t ranks;
+    uint32_t threads;
+    /** Simulated cycle the checkpoint was taken at */
+    uint64_t cycle;
+    /** Bytes of serialized data after the header */
+    uint64_t size;
+};
+
+void addCheckpointComponents(ComponentInfo* info, std::vector<ComponentInfo*>& infos)
+{
+    infos.push_back(info);
+    for ( auto& sub : info->getSubComponents() ) {
+        addCheckpointComponents(&sub.second, infos);
+    }
+}
+
+} // anonymous namespace
 
 
 TimeConverter* Simulation::minPartToTC(SimTime_t cycles) const {
@@ -58,6 +93,7 @@ Simulation::~Simulation()
     // Delete the timeVortex first.  This will delete all events left
     // in the queue, as well as the Sync, Exit and Clock objects.
     delete timeVortex;
+    delete nearFuture;
 
     // Delete all the components
     // for ( CompMap_t::iterator it = compMap.begin(); it != compMap.end(); ++it ) {
@@ -98,11 +134,15 @@ Simulation::~Simulation()
 Simulation*
 Simulation::createSimulation(Config *config, RankInfo my_rank, RankInfo num_ranks, SimTime_t min_part)
 {
-    std::thread::id tid = std::this_thread::get_id();
     Simulation* instance = new Simulation(config, my_rank, num_ranks, min_part);
 
+    // Called on the thread that will run this instance
+    context.sim = instance;
+    context.timeVortex = instance->timeVortex;
+    context.currentSimCycle = &instance->currentSimCycle;
+    context.currentPriority = &instance->currentPriority;
+
     std::lock_guard<std::mutex> lock(simulationMutex);
-    instanceMap[tid] = instance;
     instanceVec.resize(num_ranks.thread);
     instanceVec[my_rank.thread] = instance;
     return instance;
@@ -111,7 +151,7 @@ Simulation::createSimulation(Config *config, RankInfo my_rank, RankInfo num_rank
 
 void Simulation::shutdown()
 {
-    instanceMap.clear();
+    context = SimulationContext();
 }
 
 
@@ -119,7 +159,12 @@ void Simulation::shutdown()
 Simulation::Simulation( Config* cfg, RankInfo my_rank, RankInfo num_ranks, SimTime_t min_part) :
     runMode(cfg->runMode),
     timeVortex(nullptr),
+    nearFuture(nullptr),
+    rankSyncMode(cfg->rankSync),
+    nonblockingSyncReduce(cfg->nonblocking_sync_reduce),
+    threadSyncMode(cfg->threadSync),
     interThreadMinLatency(MAX_SIMTIME_T),
+    interThreadMaxLookahead(MAX_SIMTIME_T),
     threadSync(nullptr),
     currentSimCycle(0),
     endSimCycle(0),
@@ -130,7 +175,10 @@ Simulation::Simulation( Config* cfg, RankInfo my_rank, RankInfo num_ranks, SimTi
     untimed_phase(0),
     lastRecvdSignal(0),
     shutdown_mode(SHUTDOWN_CLEAN),
-    wireUpFinished(false)
+    wireUpFinished(false),
+    nextCheckpoint(MAX_SIMTIME_T),
+    checkpointCount(0),
+    checkpointPrefix(cfg->checkpointPrefix)
 {
     sim_output.init(cfg->output_core_prefix, cfg->getVerboseLevel(), 0, Output::STDOUT);
     output_directory = "";
@@ -138,6 +186,21 @@ Simulation::Simulation( Config* cfg, RankInfo my_rank, RankInfo num_ranks, SimTi
     Params p;
     //params get passed twice - both the params and a ctor argument
     timeVortex = factory->Create<TimeVortex>(cfg->timeVortex,p,p);
+    SimTime_t nearFutureWindow = timeLord.getSimCycles(cfg->nearFutureWindow, "near-future-window");
+    if ( nearFutureWindow != 0 ) {
+        nearFuture = new NearFutureQueue(timeVortex, currentSimCycle, nearFutureWindow);
+    }
+
+    // Restarting moves the clock forward before anything schedules
+    // itself from the current time
+    if ( !cfg->loadCheckpoint.empty() ) {
+        readCheckpoint(cfg->loadCheckpoint);
+    }
+    checkpointPeriod = timeLord.getSimCycles(cfg->checkpointPeriod, "checkpoint-period");
+    if ( checkpointPeriod != 0 ) {
+        nextCheckpoint = (currentSimCycle / checkpointPeriod + 1) * checkpointPeriod;
+    }
+
     if( my_rank.thread == 0 ) {
         m_exit = new Exit( num_ranks.thread, timeLord.getTimeConverter("100ns"), min_part == MAX_SIMTIME_T );
     }
@@ -157,6 +220,10 @@ void
 Simulation::setStopAtCycle( Config* cfg )
 {
     SimTime_t stopAt = timeLord.getSimCycles(cfg->stopAtCycle,"StopAction configure");
+    if ( stopAt != 0 && stopAt < currentSimCycle ) {
+        sim_output.fatal(CALL_INFO, 1, "Stop time %s is before the checkpoint's time of %s\n",
+                         cfg->stopAtCycle.c_str(), getElapsedSimTime().toStringBestSI().c_str());
+    }
     if ( stopAt != 0 ) {
     StopAction* sa = new StopAction();
     sa->setDeliveryTime(stopAt);
@@ -187,7 +254,9 @@ Simulation::requireEvent(const std::string& name)
 SimTime_t
 Simulation::getNextActivityTime() const
 {
-    return timeVortex->front()->getDeliveryTime();
+    Activity* next = timeVortex->front();
+    if ( nearFuture && nearFuture->before(next) ) next = nearFuture->front();
+    return next->getDeliveryTime();
 }
 
 SimTime_t
@@ -220,7 +289,15 @@ Simulation::processGraphInfo( ConfigGraph& graph, const RankInfo& UNUSED(myRank)
     }
 
     interThreadMinLatency = MAX_SIMTIME_T;
+    interThreadMaxLookahead = MAX_SIMTIME_T;
     int cross_thread_links = 0;
+    // Minimum latency between every pair of threads
+    size_t nthreads = num_ranks.thread;
+    std::vector<SimTime_t> pairLatencies;
+    if ( nthreads > 1 && threadSyncMode == "neighbor" ) {
+        pairLatencies.resize(nthreads * nthreads, MAX_SIMTIME_T);
+        for ( size_t i = 0; i < nthreads; i++ ) pairLatencies[i * nthreads + i] = 0;
+    }
     if ( num_ranks.thread > 1 ) {
         // Need to determine the lookahead for the thread synchronization
         ConfigComponentMap_t comps = graph.getComponentMap();
@@ -248,6 +325,11 @@ Simulation::processGraphInfo( ConfigGraph& graph, const RankInfo& UNUSED(myRank)
             if ( clink.getMinLatency() < interThreadMinLatency ) {
                 interThreadMinLatency = clink.getMinLatency();
             }
+            if ( !pairLatencies.empty() ) {
+                SimTime_t& lat0 = pairLatencies[rank[0].thread * nthreads + rank[1].thread];
+                SimTime_t& lat1 = pairLatencies[rank[1].thread * nthreads + rank[0].thread];
+                if ( clink.getMinLatency() < lat0 ) lat0 = lat1 = clink.getMinLatency();
+            }
 
             // Now check only those latencies that directly impact this
             // thread.  Keep track of minimum latency for each other
@@ -264,6 +346,28 @@ Simulation::processGraphInfo( ConfigGraph& graph, const RankInfo& UNUSED(myRank)
             }
         }
     }
+
+    // Shortest lookahead path between every pair of threads, then the
+    // longest of those.  Every thread of the rank gets the same answer.
+    if ( !pairLatencies.empty() ) {
+        for ( size_t k = 0; k < nthreads; k++ ) {
+            for ( size_t i = 0; i < nthreads; i++ ) {
+                SimTime_t ik = pairLatencies[i * nthreads + k];
+                if ( ik == MAX_SIMTIME_T ) continue;
+                for ( size_t j = 0; j < nthreads; j++ ) {
+                    SimTime_t kj = pairLatencies[k * nthreads + j];
+                    if ( kj == MAX_SIMTIME_T ) continue;
+                    if ( ik + kj < pairLatencies[i * nthreads + j] ) pairLatencies[i * nthreads + j] = ik + kj;
+                }
+            }
+        }
+        SimTime_t longest = 0;
+        for ( SimTime_t lat : pairLatencies ) {
+            if ( lat != MAX_SIMTIME_T && lat > longest ) longest = lat;
+        }
+        if ( longest != 0 ) interThreadMaxLookahead = longest;
+    }
+
     // Create the SyncManager for this rank.  It gets created even if
     // we are single rank/single thread because it also manages the
     // Exit and Heartbeat actions.
@@ -494,8 +598,14 @@ void Simulation::setup() {
 
     setupBarrier.wait();
     
-    for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
-        (*iter)->getComponent()->setup();
+    if ( restartData.empty() ) {
+        for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
+            (*iter)->getComponent()->setup();
+        }
+    }
+    else {
+        // The components were set up before the checkpoint
+        restoreCheckpoint();
     }
 
     setupBarrier.wait();
@@ -536,9 +646,17 @@ void Simulation::run() {
     header += SST::to_string(my_rank.thread);
     header += ":  ";
     while( LIKELY( ! endSim ) ) {
-        currentSimCycle = timeVortex->front()->getDeliveryTime();
-        currentPriority = timeVortex->front()->getPriority();
-        current_activity = timeVortex->pop();
+        // Take the next activity from whichever of the TimeVortex and
+        // the near-future queue has the earlier one
+        current_activity = timeVortex->front();
+        if ( nearFuture && nearFuture->before(current_activity) ) {
+            current_activity = nearFuture->pop();
+        }
+        else {
+            timeVortex->pop();
+        }
+        currentSimCycle = current_activity->getDeliveryTime();
+        currentPriority = current_activity->getPriority();
         current_activity->execute();
 
 
@@ -564,6 +682,7 @@ void Simulation::run() {
     }
     /* We shouldn't need to do this, but to be safe... */
     ThreadSync::disable();
+    syncManager->releaseThreads();
 
     runBarrier.wait();  // TODO<- Is this needed?
     if (num_ranks.rank != 1 && num_ranks.thread == 0) delete m_exit;
@@ -599,6 +718,8 @@ void Simulation::endSimulation(SimTime_t end)
     endSimCycle = end;
     endSim = true;
 
+    // Don't leave other threads waiting on this one
+    syncManager->releaseThreads();
     exitBarrier.wait();
 
 
@@ -696,6 +817,7 @@ void Simulation::printStatus(bool fullStatus)
 
     if ( fullStatus ) {
         timeVortex->print(out);
+        if ( nearFuture ) nearFuture->print(out);
         out.output("---- Components: ----\n");
         for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
             (*iter)->getComponent()->printStatus(out);
@@ -734,12 +856,13 @@ TimeConverter* Simulation::registerClock(TimeConverter *tcFreq, Clock::HandlerBa
 Cycle_t Simulation::reregisterClock( TimeConverter* tc, Clock::HandlerBase* handler, int priority )
 {
     clockMap_t::key_type mapKey = std::make_pair(tc->getFactor(), priority);
-    if ( clockMap.find( mapKey ) == clockMap.end() ) {
+    auto clock = clockMap.find( mapKey );
+    if ( clock == clockMap.end() ) {
         Output out("Simulation: @R:@t:", 0, 0, Output::STDERR);
         out.fatal(CALL_INFO, 1, "Tried to reregister with a clock that was not previously registered, exiting...\n");
     }
-    clockMap[ mapKey ]->registerHandler( handler );
-    return clockMap[ mapKey ]->getNextCycle();
+    clock->second->registerHandler( handler );
+    return clock->second->getNextCycle();
 }
 
 Cycle_t Simulation::getNextClockCycle(TimeConverter* tc, int priority) {
@@ -754,9 +877,10 @@ Cycle_t Simulation::getNextClockCycle(TimeConverter* tc, int priority) {
 
 void Simulation::unregisterClock(TimeConverter *tc, Clock::HandlerBase* handler, int priority) {
     clockMap_t::key_type mapKey = std::make_pair(tc->getFactor(), priority);
-    if ( clockMap.find( mapKey ) != clockMap.end() ) {
+    auto clock = clockMap.find( mapKey );
+    if ( clock != clockMap.end() ) {
         bool empty;
-        clockMap[ mapKey ]->unregisterHandler( handler, empty );
+        clock->second->unregisterHandler( handler, empty );
     }
 }
 
@@ -790,18 +914,226 @@ void Simulation::insertActivity(SimTime_t time, Activity* ev) {
 
 }
 
+void
+Simulation::getCheckpointComponents(std::vector<ComponentInfo*>& infos)
+{
+    std::vector<ComponentInfo*> top(compInfoMap.begin(), compInfoMap.end());
+    std::sort(top.begin(), top.end(),
+              [](ComponentInfo* a, ComponentInfo* b) { return a->getID() < b->getID(); });
+    for ( auto info : top ) {
+        addCheckpointComponents(info, infos);
+    }
+}
+
+void
+Simulation::serializeCheckpoint(SST::Core::Serialization::serializer& ser, std::vector<ComponentInfo*>& infos,
+                                std::vector<CheckpointEvent>& events)
+{
+    StatisticProcessingEngine* engine = StatisticProcessingEngine::getInstance();
+
+    size_t count = infos.size();
+    ser & count;
+    if ( count != infos.size() ) {
+        sim_output.fatal(CALL_INFO, 1, "Checkpoint has %zu components, but this thread has %zu\n",
+                         count, infos.size());
+    }
+    for ( auto info : infos ) {
+        ComponentId_t id = info->getID();
+        ser & id;
+        if ( id != info->getID() ) {
+            sim_output.fatal(CALL_INFO, 1, "Checkpoint has component %" PRIu64 " where this thread has %s\n",
+                             id, info->getName().c_str());
+        }
+        if ( info->getComponent() ) info->getComponent()->serialize_order(ser);
+        engine->serializeComponentStatistics(id, ser);
+    }
+
+    size_t numEvents = events.size();
+    ser & numEvents;
+    events.resize(numEvents);
+    for ( auto& entry : events ) {
+        ser & entry.comp;
+        ser & entry.port;
+        ser & entry.event;
+    }
+}
+
+void
+Simulation::checkpoint()
+{
+    std::vector<ComponentInfo*> infos;
+    getCheckpointComponents(infos);
+
+    // Name each link by the component and port it delivers to
+    std::unordered_map<Link*, std::pair<ComponentId_t, const std::string*> > ports;
+    for ( auto info : infos ) {
+        for ( auto& port : info->getLinkMap()->getLinkMap() ) {
+            ports.emplace(port.second, std::make_pair(info->getID(), &port.first));
+        }
+    }
+
+    // Empty the queues, keeping the events.  Every activity goes back
+    // to its queue afterwards in the order it came out.
+    std::vector<std::pair<ActivityQueue*, Activity*> > queued;
+    std::vector<CheckpointEvent> events;
+    auto drain = [&](ActivityQueue* queue) {
+        while ( !queue->empty() ) {
+            Activity* act = queue->pop();
+            queued.emplace_back(queue, act);
+            Event* ev = dynamic_cast<Event*>(act);
+            if ( nullptr == ev ) continue;
+            auto port = ports.find(ev->getDeliveryLink());
+            if ( port == ports.end() ) {
+                sim_output.fatal(CALL_INFO, 1, "Checkpoint found an event for a link no component on this thread owns\n");
+            }
+            events.push_back({ port->second.first, *port->second.second, act });
+        }
+    };
+    drain(timeVortex);
+    if ( nearFuture ) drain(nearFuture);
+    for ( auto info : infos ) {
+        for ( auto& port : info->getLinkMap()->getLinkMap() ) {
+            if ( port.second->type == Link::POLL ) drain(port.second->recvQueue);
+        }
+    }
+
+    SST::Core::Serialization::serializer ser;
+    ser.start_sizing();
+    serializeCheckpoint(ser, infos, events);
+    std::vector<char> buffer(ser.size());
+    ser.start_packing(buffer.data(), buffer.size());
+    serializeCheckpoint(ser, infos, events);
+
+    for ( auto& entry : queued ) {
+        entry.first->insert(entry.second);
+    }
+
+    CheckpointHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.version = CHECKPOINT_VERSION;
+    header.index = checkpointCount;
+    header.rank = my_rank.rank;
+    header.thread = my_rank.thread;
+    header.ranks = num_ranks.rank;
+    header.threads = num_ranks.thread;
+    header.cycle = currentSimCycle;
+    header.size = buffer.size();
+
+    std::string name = checkpointPrefix + "_" + SST::to_string(checkpointCount);
+    std::string fileName = name + "_" + SST::to_string(my_rank.rank) + "_" + SST::to_string(my_rank.thread) + ".sstckpt";
+    FILE* fp = fopen(fileName.c_str(), "wb");
+    if ( nullptr == fp ) {
+        sim_output.fatal(CALL_INFO, 1, "Unable to open checkpoint %s: %s\n", fileName.c_str(), strerror(errno));
+    }
+    bool written = ( 1 == fwrite(&header, sizeof(header), 1, fp) &&
+                     buffer.size() == fwrite(buffer.data(), 1, buffer.size(), fp) );
+    if ( 0 != fclose(fp) || !written ) {
+        sim_output.fatal(CALL_INFO, 1, "Unable to write checkpoint %s\n", fileName.c_str());
+    }
+
+    if ( my_rank.rank == 0 && my_rank.thread == 0 ) {
+        sim_output.verbose(CALL_INFO, 1, 0, "# Wrote checkpoint %s at %s\n",
+                           name.c_str(), getElapsedSimTime().toStringBestSI().c_str());
+    }
+    checkpointCount++;
+    nextCheckpoint = (currentSimCycle / checkpointPeriod + 1) * checkpointPeriod;
+}
+
+void
+Simulation::readCheckpoint(const std::string& name)
+{
+    std::string fileName = name + "_" + SST::to_string(my_rank.rank) + "_" + SST::to_string(my_rank.thread) + ".sstckpt";
+    FILE* fp = fopen(fileName.c_str(), "rb");
+    if ( nullptr == fp ) {
+        sim_output.fatal(CALL_INFO, 1, "Unable to open checkpoint %s: %s\n", fileName.c_str(), strerror(errno));
+    }
+
+    CheckpointHeader header;
+    if ( 1 != fread(&header, sizeof(header), 1, fp) ||
+         memcmp(header.magic, CHECKPOINT_MAGIC, sizeof(header.magic)) ) {
+        sim_output.fatal(CALL_INFO, 1, "%s is not a checkpoint\n", fileName.c_str());
+    }
+    if ( header.version != CHECKPOINT_VERSION ) {
+        sim_output.fatal(CALL_INFO, 1, "%s has version %" PRIu32 ", expected %" PRIu32 "\n",
+                         fileName.c_str(), header.version, CHECKPOINT_VERSION);
+    }
+    if ( header.ranks != num_ranks.rank || header.threads != num_ranks.thread ||
+         header.rank != my_rank.rank || header.thread != my_rank.thread ) {
+        sim_output.fatal(CALL_INFO, 1, "%s was written by rank %" PRIu32 ", thread %" PRIu32 " of a run with %" PRIu32
+                         " ranks and %" PRIu32 " threads\n", fileName.c_str(), header.rank, header.thread,
+                         header.ranks, header.threads);
+    }
+    restartData.resize(header.size);
+    if ( header.size != fread(restartData.data(), 1, header.size, fp) ) {
+        sim_output.fatal(CALL_INFO, 1, "%s is truncated\n", fileName.c_str());
+    }
+    fclose(fp);
+
+    // The checkpoint was taken by a sync, so everything of a lower
+    // priority at this time has already run
+    currentSimCycle = header.cycle;
+    currentPriority = SYNCPRIORITY;
+    checkpointCount = header.index + 1;
+
+    if ( my_rank.rank == 0 && my_rank.thread == 0 ) {
+        sim_output.verbose(CALL_INFO, 1, 0, "# Restarting from checkpoint %s at %s\n",
+                           name.c_str(), getElapsedSimTime().toStringBestSI().c_str());
+    }
+}
+
+void
+Simulation::restoreCheckpoint()
+{
+    std::vector<ComponentInfo*> infos;
+    getCheckpointComponents(infos);
+
+    std::vector<CheckpointEvent> events;
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(restartData.data(), restartData.size());
+    serializeCheckpoint(ser, infos, events);
+    std::vector<char>().swap(restartData);
+
+    std::unordered_map<ComponentId_t, ComponentInfo*> byID;
+    for ( auto info : infos ) {
+        byID[info->getID()] = info;
+    }
+    for ( auto& entry : events ) {
+        Event* ev = static_cast<Event*>(entry.event);
+        auto info = byID.find(entry.comp);
+        Link* link = ( info == byID.end() ) ? nullptr : info->second->getLinkMap()->getLink(entry.port);
+        if ( nullptr == link ) {
+            sim_output.fatal(CALL_INFO, 1, "Checkpoint has an event for port %s of component %" PRIu64 ", which has no link there\n",
+                             entry.port.c_str(), entry.comp);
+        }
+        ev->setDeliveryLink(ev->getLinkId(), link);
+        link->recvQueue->insert(ev);
+    }
+}
+
 uint64_t Simulation::getTimeVortexMaxDepth() const {
     return timeVortex->getMaxDepth();
 }
 
 uint64_t Simulation::getTimeVortexCurrentDepth() const {
-    return timeVortex->getCurrentDepth();
+    uint64_t depth = timeVortex->getCurrentDepth();
+    if ( nearFuture ) depth += nearFuture->size();
+    return depth;
+}
+
+ActivityQueue* Simulation::getLinkQueue() const {
+    if ( nearFuture ) return nearFuture;
+    return timeVortex;
 }
 
 uint64_t Simulation::getSyncQueueDataSize() const {
     return syncManager->getDataSize();
 }
 
+void Simulation::publishSafeTime() {
+    syncManager->publishSafeTime(currentSimCycle);
+}
+
 Statistics::StatisticProcessingEngine* Simulation::getStatisticsProcessingEngine(void) const
 {
     return Statistics::StatisticProcessingEngine::getInstance();
@@ -858,7 +1190,7 @@ SimTime_t Simulation::minPart;
 
 /* Define statics (Simulation) */
 SharedRegionManager* Simulation::sharedRegionManager = new SharedRegionManagerImpl();
-std::unordered_map<std::thread::id, Simulation*> Simulation::instanceMap;
+thread_local SimulationContext Simulation::context;
 std::vector<Simulation*> Simulation::instanceVec;
 std::atomic<int> Simulation::untimed_msg_count;
 Exit* Simulation::m_exit;
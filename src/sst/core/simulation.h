@@ -41,6 +41,7 @@ namespace SST {
 #define STATALLFLAG "--ALLSTATS--"
 
 class Activity;
+class ActivityQueue;
 class Component;
 class Config;
 class ConfigGraph;
@@ -49,6 +50,7 @@ class Factory;
 class SimulatorHeartbeat;
 //class Graph;
 class LinkMap;
+class NearFutureQueue;
 class Params;
 class SyncBase;
 class SyncManager;
@@ -56,6 +58,7 @@ class ThreadSync;
 class TimeConverter;
 class TimeLord;
 class TimeVortex;
+class Simulation;
 class UnitAlgebra;
 class SharedRegionManager;
 namespace Statistics {
@@ -65,6 +68,19 @@ namespace Statistics {
 
 
 
+/**
+ * State of the Simulation running on the calling thread.  The core hot
+ * paths (Link::send(), Clock::execute(), ...) read it directly instead
+ * of looking the Simulation up by thread id.
+ */
+struct SimulationContext {
+    Simulation*      sim;
+    TimeVortex*      timeVortex;
+    const SimTime_t* currentSimCycle;
+    const int*       currentPriority;
+};
+
+
 /**
  * Main control class for a SST Simulation.
  * Provides base features for managing the simulation
@@ -96,7 +112,9 @@ public:
      */
     static void shutdown();
     /** Return a pointer to the singleton instance of the Simulation */
-    static Simulation *getSimulation() { return instanceMap.at(std::this_thread::get_id()); }
+    static Simulation *getSimulation() { return context.sim; }
+    /** Return the state of the Simulation running on this thread */
+    static const SimulationContext& getContext() { return context; }
     /** Sets an internal flag for signaling the simulation.  Used internally */
     static void setSignal(int signal);
     /** Causes the current status of the simulation to be printed to stderr.
@@ -170,6 +188,10 @@ public:
 
     const std::vector<SimTime_t>& getInterThreadLatencies() const { return interThreadLatencies; }
     SimTime_t getInterThreadMinLatency() const { return interThreadMinLatency; }
+    /** Longest lookahead between two threads of this rank, going
+     * through other threads where that is shorter.  Only computed for
+     * the neighbor thread sync, MAX_SIMTIME_T otherwise. */
+    SimTime_t getInterThreadMaxLookahead() const { return interThreadMaxLookahead; }
     static TimeConverter* getMinPartTC() { return minPartTC; }
 
     /** Return the TimeLord associated with this Simulation */
@@ -180,6 +202,10 @@ public:
     uint64_t getTimeVortexMaxDepth() const;
     uint64_t getTimeVortexCurrentDepth() const;
     uint64_t getSyncQueueDataSize() const;
+    /** Tell threads that sync with this one without barriers that it
+     * will not execute anything before the current cycle.  Needed
+     * before this thread blocks on other threads outside a sync. */
+    void publishSafeTime();
 
     /** Return the Statistic Processing Engine associated with this Simulation */
     Statistics::StatisticProcessingEngine* getStatisticsProcessingEngine(void) const;
@@ -290,6 +316,25 @@ private:
      */
     TimeConverter* minPartToTC(SimTime_t cycles) const;
 
+    /** An event waiting in a queue, named by the port it arrives on */
+    struct CheckpointEvent {
+        ComponentId_t comp;
+        std::string   port;
+        Activity*     event;
+    };
+
+    /** Write this thread's checkpoint file.  Called by the SyncManager
+     * at a sync, when no events are in flight to this thread */
+    void checkpoint();
+    /** Read this thread's checkpoint file and start at its time */
+    void readCheckpoint(const std::string& name);
+    /** Restore the components and events read by readCheckpoint() */
+    void restoreCheckpoint();
+    /** Get this thread's components and subcomponents in ID order */
+    void getCheckpointComponents(std::vector<ComponentInfo*>& infos);
+    void serializeCheckpoint(SST::Core::Serialization::serializer& ser, std::vector<ComponentInfo*>& infos,
+                             std::vector<CheckpointEvent>& events);
+
     /** Factory used to generate the simulation components */
     static Factory *factory;
     /** TimeLord of the simulation */
@@ -311,6 +356,9 @@ private:
                                Params &params);
 
     TimeVortex* getTimeVortex() const { return timeVortex; }
+    /** Returns the queue that events sent on handler links are
+     * delivered to */
+    ActivityQueue* getLinkQueue() const;
 
     /** Emergency Shutdown
      * Called when a SIGINT or SIGTERM has been seen
@@ -331,12 +379,17 @@ private:
     
     Mode_t   runMode;
     TimeVortex*      timeVortex;
+    NearFutureQueue* nearFuture;
+    std::string      rankSyncMode;
+    bool             nonblockingSyncReduce;
+    std::string      threadSyncMode;
     TimeConverter*   threadMinPartTC;
     Activity*        current_activity;
     static SimTime_t minPart;
     static TimeConverter*   minPartTC;
     std::vector<SimTime_t> interThreadLatencies;
     SimTime_t        interThreadMinLatency;
+    SimTime_t        interThreadMaxLookahead;
     SyncManager*     syncManager;
     ThreadSync*      threadSync;
     ComponentInfoMap compInfoMap;
@@ -358,8 +411,13 @@ private:
     std::string      output_directory;
     static SharedRegionManager* sharedRegionManager;
     bool             wireUpFinished;
+    SimTime_t        checkpointPeriod;
+    SimTime_t        nextCheckpoint;
+    uint32_t         checkpointCount;
+    std::string      checkpointPrefix;
+    std::vector<char> restartData;
 
-    static std::unordered_map<std::thread::id, Simulation*> instanceMap;
+    static thread_local SimulationContext context;
     static std::vector<Simulation*> instanceVec;
 
     friend void wait_my_turn_start();
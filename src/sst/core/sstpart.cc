@@ -13,6 +13,8 @@
 
 #include "sst/core/sstpart.h"
 
+#include "sst/core/configGraph.h"
+
 namespace SST {
 namespace Partition {
 
@@ -33,6 +35,13 @@ SSTPartitioner::performPartition(ConfigGraph* UNUSED(graph))
   output.fatal(CALL_INFO, 1, "ERROR: chosen partitioner does not support ConfigGraph");
 }
 
+int64_t
+SSTPartitioner::getCutCost(const PartitionLink& link, size_t num_links) const
+{
+    if ( link.getMinLatency() < latency_threshold ) return num_links + 1;
+    return 1;
+}
+
 }
 }
 
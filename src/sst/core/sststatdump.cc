@@ -0,0 +1,149 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "sst/core/statapi/statbinaryreader.h"
+
+using namespace SST::Statistics;
+using namespace SST::Statistics::BinaryFormat;
+
+void print_usage(FILE* output) {
+    fprintf(output, "sst-stat-dump [--info] [--separator <SEP>] <FILE>\n");
+    fprintf(output, "\n");
+    fprintf(output, "Prints a file written by the sst.statOutputBinary statistic\n");
+    fprintf(output, "output in the format of sst.statOutputCSV.\n");
+    fprintf(output, "\n");
+    fprintf(output, "--info            Print the fields, statistics and blocks\n");
+    fprintf(output, "                  in the file instead of the entries.\n");
+    fprintf(output, "--separator <SEP> Separator between values, default \", \"\n");
+    exit(1);
+}
+
+static void print_value(const StatisticBinaryReader::Block& block, uint32_t type, size_t column, size_t row)
+{
+    switch ( type ) {
+    case INT32:  printf("%" PRId32, block.getColumn<int32_t>(column)[row]); break;
+    case UINT32: printf("%" PRIu32, block.getColumn<uint32_t>(column)[row]); break;
+    case INT64:  printf("%" PRId64, block.getColumn<int64_t>(column)[row]); break;
+    case UINT64: printf("%" PRIu64, block.getColumn<uint64_t>(column)[row]); break;
+    case FLOAT:  printf("%f", block.getColumn<float>(column)[row]); break;
+    case DOUBLE: printf("%f", block.getColumn<double>(column)[row]); break;
+    }
+}
+
+static void print_info(const StatisticBinaryReader& reader)
+{
+    printf("Rank: %d\n", reader.getRank());
+
+    printf("Fields: %zu\n", reader.getFields().size());
+    for ( size_t i = 0; i < reader.getFields().size(); i++ ) {
+        const StatisticBinaryReader::Field& field = reader.getFields()[i];
+        printf("  %zu: %s.%s (%s)\n", i, field.statName.c_str(), field.fieldName.c_str(), fieldShortName(field.type));
+    }
+
+    std::vector<uint64_t> rows(reader.getTables().size(), 0);
+    std::vector<uint64_t> blocks(reader.getTables().size(), 0);
+    for ( auto& block : reader.getBlocks() ) {
+        rows[block.table] += block.numRows;
+        blocks[block.table]++;
+    }
+
+    printf("Tables: %zu\n", reader.getTables().size());
+    for ( size_t i = 0; i < reader.getTables().size(); i++ ) {
+        printf("  %zu: %" PRIu64 " entries in %" PRIu64 " blocks, fields", i, rows[i], blocks[i]);
+        for ( uint32_t field : reader.getTables()[i].fields ) {
+            printf(" %" PRIu32, field);
+        }
+        printf("\n");
+    }
+
+    printf("Statistics: %zu\n", reader.getStats().size());
+    for ( size_t i = 0; i < reader.getStats().size(); i++ ) {
+        const StatisticBinaryReader::Stat& stat = reader.getStats()[i];
+        printf("  %zu: %s.%s%s%s (%s), component %" PRIu64 ", rank %" PRId32 ", table %" PRIu32 "\n", i,
+               stat.component.c_str(), stat.statName.c_str(), stat.subId.empty() ? "" : ".", stat.subId.c_str(),
+               stat.statType.c_str(), stat.componentId, stat.rank, stat.table);
+    }
+}
+
+static void print_entries(const StatisticBinaryReader& reader, const char* sep)
+{
+    const auto& fields = reader.getFields();
+
+    printf("ComponentName%sStatisticName%sStatisticSubId%sStatisticType%sSimTime%sRank", sep, sep, sep, sep, sep);
+    for ( auto& field : fields ) {
+        printf("%s%s.%s", sep, field.fieldName.c_str(), fieldShortName(field.type));
+    }
+    printf("\n");
+
+    // Column of each field in the current table, -1 if it has none
+    std::vector<long> fieldColumn(fields.size());
+    for ( auto& block : reader.getBlocks() ) {
+        const auto& tableFields = reader.getTables()[block.table].fields;
+        std::fill(fieldColumn.begin(), fieldColumn.end(), -1);
+        for ( size_t c = 0; c < tableFields.size(); c++ ) {
+            fieldColumn[tableFields[c]] = c;
+        }
+
+        for ( uint32_t row = 0; row < block.numRows; row++ ) {
+            const StatisticBinaryReader::Stat& stat = reader.getStats().at(block.stats[row]);
+            printf("%s%s%s%s%s%s%s%s%" PRIu64 "%s%d", stat.component.c_str(), sep, stat.statName.c_str(), sep,
+                   stat.subId.c_str(), sep, stat.statType.c_str(), sep, block.simTime, sep, stat.rank);
+            for ( size_t f = 0; f < fields.size(); f++ ) {
+                printf("%s", sep);
+                if ( fieldColumn[f] < 0 ) printf("0");
+                else print_value(block, fields[f].type, fieldColumn[f], row);
+            }
+            printf("\n");
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    bool info = false;
+    std::string separator = ", ";
+    const char* path = nullptr;
+
+    for ( int i = 1; i < argc; i++ ) {
+        if ( strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-help") == 0 ) {
+            print_usage(stdout);
+        } else if ( strcmp(argv[i], "--info") == 0 ) {
+            info = true;
+        } else if ( strcmp(argv[i], "--separator") == 0 && i + 1 < argc ) {
+            separator = argv[++i];
+        } else if ( path == nullptr && argv[i][0] != '-' ) {
+            path = argv[i];
+        } else {
+            print_usage(stderr);
+        }
+    }
+    if ( path == nullptr ) print_usage(stderr);
+
+    StatisticBinaryReader reader;
+    if ( !reader.open(path) ) {
+        fprintf(stderr, "sst-stat-dump: %s\n", reader.getError().c_str());
+        return 1;
+    }
+
+    if ( info ) print_info(reader);
+    else print_entries(reader, separator.c_str());
+
+    return 0;
+}
@@ -0,0 +1,513 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "sst/core/statapi/statbinaryreader.h"
+
+using namespace SST::Statistics;
+using namespace SST::Statistics::BinaryFormat;
+
+/* Contents of the .index file written by rank 0 */
+struct RankIndex {
+    std::string format;
+    std::map<std::string, std::string> options;
+    std::vector<std::string> files;
+
+    std::string getOption(const std::string& key, const std::string& def) const {
+        auto iter = options.find(key);
+        return iter == options.end() ? def : iter->second;
+    }
+};
+
+void print_usage(FILE* output) {
+    fprintf(output, "sst-stat-merge [-o <OUTPUT>] <INDEX>\n");
+    fprintf(output, "\n");
+    fprintf(output, "Combines the per-rank files written by the CSV, JSON and\n");
+    fprintf(output, "binary statistic outputs in a parallel run into one file.\n");
+    fprintf(output, "<INDEX> is the <filepath>.index file written by rank 0.\n");
+    fprintf(output, "Entries are ordered by simulated time and then by\n");
+    fprintf(output, "component id (component name for CSV, which has no ids).\n");
+    fprintf(output, "\n");
+    fprintf(output, "-o <OUTPUT>  File to write, default is <INDEX> without\n");
+    fprintf(output, "             the .index suffix, the filepath of the run.\n");
+    exit(1);
+}
+
+static void fatal(const char* fmt, const std::string& arg)
+{
+    fprintf(stderr, "sst-stat-merge: ");
+    fprintf(stderr, fmt, arg.c_str());
+    fprintf(stderr, "\n");
+    exit(1);
+}
+
+static void read_index(const std::string& path, RankIndex& index)
+{
+    std::ifstream in(path);
+    if ( !in ) fatal("Unable to open %s", path);
+
+    // Files are named relative to the index
+    std::string dir;
+    size_t slash = path.find_last_of("/");
+    if ( std::string::npos != slash ) dir = path.substr(0, slash + 1);
+
+    std::string line;
+    uint32_t ranks = 0;
+    while ( std::getline(in, line) ) {
+        if ( line.empty() || line[0] == '#' ) continue;
+        size_t space = line.find(' ');
+        std::string key = line.substr(0, space);
+        std::string value = (std::string::npos == space) ? "" : line.substr(space + 1);
+
+        if ( key == "format" ) {
+            index.format = value;
+        } else if ( key == "ranks" ) {
+            ranks = strtoul(value.c_str(), nullptr, 10);
+            index.files.resize(ranks);
+        } else if ( key == "rank" ) {
+            char* end;
+            unsigned long rank = strtoul(value.c_str(), &end, 10);
+            if ( rank >= ranks || *end != ' ' ) fatal("Bad rank line in %s", path);
+            index.files[rank] = dir + (end + 1);
+        } else {
+            index.options[key] = value;
+        }
+    }
+
+    if ( index.files.empty() ) fatal("No files listed in %s", path);
+    for ( auto& file : index.files ) {
+        if ( file.empty() ) fatal("Missing a rank in %s", path);
+    }
+}
+
+static FILE* open_output(const std::string& path)
+{
+    FILE* fp = fopen(path.c_str(), "wb");
+    if ( nullptr == fp ) fatal("Unable to open %s", path);
+    return fp;
+}
+
+
+/* CSV: fields are matched up by the column names in the headers */
+
+static std::vector<std::string> split(const std::string& line, const std::string& sep)
+{
+    std::vector<std::string> cells;
+    size_t start = 0;
+    size_t pos;
+    while ( std::string::npos != (pos = line.find(sep, start)) ) {
+        cells.push_back(line.substr(start, pos - start));
+        start = pos + sep.length();
+    }
+    cells.push_back(line.substr(start));
+    return cells;
+}
+
+static void merge_csv(const RankIndex& index, const std::string& outPath)
+{
+    if ( index.getOption("compressed", "0") == "1" ) {
+        fatal("%s: compressed CSV files are not supported", index.files[0]);
+    }
+    std::string sep = index.getOption("separator", ", ");
+    bool header = index.getOption("header", "1") == "1";
+    bool simTime = index.getOption("simtime", "1") == "1";
+    size_t numFixed = 4 + (simTime ? 1 : 0) + (index.getOption("outputrank", "1") == "1" ? 1 : 0);
+
+    struct Row {
+        uint64_t time;
+        std::string component;
+        size_t shard;
+        std::string line;
+    };
+
+    std::vector<std::string> fixedNames;
+    std::vector<std::string> fieldNames;
+    std::map<std::string, size_t> fieldIndex;
+    std::vector<std::vector<size_t>> shardFields(index.files.size());
+    std::vector<Row> rows;
+
+    for ( size_t shard = 0; shard < index.files.size(); shard++ ) {
+        std::ifstream in(index.files[shard]);
+        if ( !in ) fatal("Unable to open %s", index.files[shard]);
+
+        std::string line;
+        if ( header && std::getline(in, line) ) {
+            std::vector<std::string> cells = split(line, sep);
+            if ( cells.size() < numFixed ) fatal("%s: bad header", index.files[shard]);
+            fixedNames.assign(cells.begin(), cells.begin() + numFixed);
+            for ( size_t i = numFixed; i < cells.size(); i++ ) {
+                auto iter = fieldIndex.find(cells[i]);
+                if ( iter == fieldIndex.end() ) {
+                    iter = fieldIndex.emplace(cells[i], fieldNames.size()).first;
+                    fieldNames.push_back(cells[i]);
+                }
+                shardFields[shard].push_back(iter->second);
+            }
+        }
+
+        while ( std::getline(in, line) ) {
+            std::vector<std::string> cells = split(line, sep);
+            if ( cells.size() < numFixed ) fatal("%s: bad line", index.files[shard]);
+            if ( !header ) {
+                // Without headers the columns can only be matched by position
+                while ( shardFields[shard].size() < cells.size() - numFixed ) {
+                    shardFields[shard].push_back(shardFields[shard].size());
+                }
+                if ( fieldNames.size() < shardFields[shard].size() ) fieldNames.resize(shardFields[shard].size());
+            }
+            uint64_t time = simTime ? strtoull(cells[4].c_str(), nullptr, 10) : 0;
+            rows.push_back({time, cells[0], shard, line});
+        }
+    }
+
+    std::stable_sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) {
+        return std::tie(a.time, a.component) < std::tie(b.time, b.component);
+    });
+
+    FILE* out = open_output(outPath);
+    if ( header ) {
+        std::vector<std::string> names = fixedNames;
+        names.insert(names.end(), fieldNames.begin(), fieldNames.end());
+        for ( size_t i = 0; i < names.size(); i++ ) {
+            fprintf(out, "%s%s", i ? sep.c_str() : "", names[i].c_str());
+        }
+        fprintf(out, "\n");
+    }
+
+    std::vector<const std::string*> values;
+    const std::string zero = "0";
+    for ( auto& row : rows ) {
+        const std::vector<size_t>& mapping = shardFields[row.shard];
+        std::vector<std::string> cells = split(row.line, sep);
+
+        values.assign(fieldNames.size(), &zero);
+        for ( size_t i = numFixed; i < cells.size() && i - numFixed < mapping.size(); i++ ) {
+            values[mapping[i - numFixed]] = &cells[i];
+        }
+        for ( size_t i = 0; i < numFixed; i++ ) {
+            fprintf(out, "%s%s", i ? sep.c_str() : "", cells[i].c_str());
+        }
+        for ( auto value : values ) {
+            fprintf(out, "%s%s", sep.c_str(), value->c_str());
+        }
+        fprintf(out, "\n");
+    }
+    fclose(out);
+}
+
+
+/* JSON: every statistic entry is on its own line, inside an object
+ * naming its component */
+
+static std::string get_json_value(const std::string& line, const std::string& key)
+{
+    std::string tag = "\"" + key + "\" : ";
+    size_t pos = line.find(tag);
+    if ( std::string::npos == pos ) return "";
+    pos += tag.length();
+    if ( line[pos] == '"' ) {
+        return line.substr(pos + 1, line.find('"', pos + 1) - pos - 1);
+    }
+    return line.substr(pos, line.find_first_of(",} ", pos) - pos);
+}
+
+static void merge_json(const RankIndex& index, const std::string& outPath)
+{
+    struct Entry {
+        uint64_t time;
+        uint64_t id;
+        std::string component;
+        size_t rank;
+        std::string line;
+    };
+
+    std::vector<Entry> entries;
+    for ( size_t rank = 0; rank < index.files.size(); rank++ ) {
+        std::ifstream in(index.files[rank]);
+        if ( !in ) fatal("Unable to open %s", index.files[rank]);
+
+        std::string line;
+        std::string component;
+        uint64_t id = 0;
+        while ( std::getline(in, line) ) {
+            size_t start = line.find_first_not_of(' ');
+            if ( std::string::npos == start ) continue;
+            line.erase(0, start);
+
+            if ( 0 == line.compare(0, 8, "\"name\" :") ) {
+                component = get_json_value(line, "name");
+            } else if ( 0 == line.compare(0, 6, "\"id\" :") ) {
+                id = strtoull(get_json_value(line, "id").c_str(), nullptr, 10);
+            } else if ( 0 == line.compare(0, 8, "{ \"stat\"") ) {
+                if ( line.back() == ',' ) line.pop_back();
+                uint64_t time = strtoull(get_json_value(line, "time").c_str(), nullptr, 10);
+                entries.push_back({time, id, component, rank, line});
+            }
+        }
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return std::tie(a.time, a.id) < std::tie(b.time, b.id);
+    });
+
+    FILE* out = open_output(outPath);
+    fprintf(out, "{\n");
+    fprintf(out, "   \"components\" : [\n");
+    for ( size_t i = 0; i < entries.size(); i++ ) {
+        const Entry& entry = entries[i];
+        bool first = (i == 0 || entries[i - 1].component != entry.component || entries[i - 1].rank != entry.rank);
+        bool last = (i + 1 == entries.size() || entries[i + 1].component != entry.component ||
+                     entries[i + 1].rank != entry.rank);
+        if ( first ) {
+            fprintf(out, "      {\n");
+            fprintf(out, "         \"name\" : \"%s\",\n", entry.component.c_str());
+            fprintf(out, "         \"id\" : %" PRIu64 ",\n", entry.id);
+            fprintf(out, "         \"rank\" : %zu,\n", entry.rank);
+            fprintf(out, "         \"statistics\" : [\n");
+        }
+        fprintf(out, "            %s%s\n", entry.line.c_str(), last ? "" : ",");
+        if ( last ) {
+            fprintf(out, "         ]\n");
+            fprintf(out, "      }%s\n", i + 1 == entries.size() ? "" : ",");
+        }
+    }
+    fprintf(out, "   ]\n");
+    fprintf(out, "}\n");
+    fclose(out);
+}
+
+
+/* Binary: the registries are combined and the rows of each table at
+ * each time are gathered into one block */
+
+static void write_string(FILE* out, const std::string& str)
+{
+    uint32_t len = str.length();
+    fwrite(&len, sizeof(len), 1, out);
+    fwrite(str.data(), 1, len, out);
+}
+
+static void write_padding(FILE* out, size_t bytes)
+{
+    static const char zeros[8] = { 0 };
+    fwrite(zeros, 1, padTo8(bytes) - bytes, out);
+}
+
+static void merge_binary(const RankIndex& index, const std::string& outPath)
+{
+    size_t numShards = index.files.size();
+    std::vector<StatisticBinaryReader> readers(numShards);
+
+    std::vector<StatisticBinaryReader::Field> fields;
+    std::vector<std::vector<uint32_t>> tables;
+    std::vector<StatisticBinaryReader::Stat> stats;
+
+    std::map<std::tuple<std::string, std::string, uint32_t>, uint32_t> fieldMap;
+    std::map<std::vector<uint32_t>, uint32_t> tableMap;
+    std::vector<std::vector<uint32_t>> shardTables(numShards);
+    std::vector<uint32_t> shardStatBase(numShards);
+
+    for ( size_t shard = 0; shard < numShards; shard++ ) {
+        StatisticBinaryReader& reader = readers[shard];
+        if ( !reader.open(index.files[shard]) ) fatal("%s", reader.getError());
+
+        std::vector<uint32_t> shardFields;
+        for ( auto& field : reader.getFields() ) {
+            auto key = std::make_tuple(field.statName, field.fieldName, field.type);
+            auto iter = fieldMap.find(key);
+            if ( iter == fieldMap.end() ) {
+                iter = fieldMap.emplace(key, fields.size()).first;
+                fields.push_back(field);
+            }
+            shardFields.push_back(iter->second);
+        }
+
+        for ( auto& table : reader.getTables() ) {
+            std::vector<uint32_t> merged;
+            for ( uint32_t field : table.fields ) merged.push_back(shardFields[field]);
+            auto iter = tableMap.find(merged);
+            if ( iter == tableMap.end() ) {
+                iter = tableMap.emplace(merged, tables.size()).first;
+                tables.push_back(merged);
+            }
+            shardTables[shard].push_back(iter->second);
+        }
+
+        shardStatBase[shard] = stats.size();
+        for ( auto stat : reader.getStats() ) {
+            stat.table = shardTables[shard][stat.table];
+            stats.push_back(stat);
+        }
+    }
+
+    /* Registries */
+    FILE* out = open_output(outPath);
+    FileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.rank = -1;
+    header.numFields = fields.size();
+    header.numTables = tables.size();
+    header.numStats = stats.size();
+    fwrite(&header, sizeof(header), 1, out);
+
+    for ( auto& field : fields ) {
+        fwrite(&field.type, sizeof(field.type), 1, out);
+        write_string(out, field.statName);
+        write_string(out, field.fieldName);
+        write_padding(out, 3 * sizeof(uint32_t) + field.statName.length() + field.fieldName.length());
+    }
+    for ( auto& table : tables ) {
+        uint32_t numColumns = table.size();
+        fwrite(&numColumns, sizeof(numColumns), 1, out);
+        fwrite(table.data(), sizeof(uint32_t), numColumns, out);
+        write_padding(out, (numColumns + 1) * sizeof(uint32_t));
+    }
+    for ( auto& stat : stats ) {
+        fwrite(&stat.table, sizeof(stat.table), 1, out);
+        fwrite(&stat.rank, sizeof(stat.rank), 1, out);
+        fwrite(&stat.componentId, sizeof(stat.componentId), 1, out);
+        write_string(out, stat.component);
+        write_string(out, stat.statName);
+        write_string(out, stat.subId);
+        write_string(out, stat.statType);
+        write_padding(out, 6 * sizeof(uint32_t) + sizeof(stat.componentId) + stat.component.length() +
+                      stat.statName.length() + stat.subId.length() + stat.statType.length());
+    }
+    header.dataOffset = ftell(out);
+    fseek(out, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, out);
+    fseek(out, header.dataOffset, SEEK_SET);
+
+    /* Blocks, in order of time and then table */
+    struct BlockRef {
+        uint64_t time;
+        uint32_t table;
+        size_t shard;
+        const StatisticBinaryReader::Block* block;
+    };
+    std::vector<BlockRef> blocks;
+    for ( size_t shard = 0; shard < numShards; shard++ ) {
+        for ( auto& block : readers[shard].getBlocks() ) {
+            blocks.push_back({block.simTime, shardTables[shard][block.table], shard, &block});
+        }
+    }
+    std::stable_sort(blocks.begin(), blocks.end(), [](const BlockRef& a, const BlockRef& b) {
+        return std::tie(a.time, a.table) < std::tie(b.time, b.table);
+    });
+
+    struct RowRef {
+        uint64_t componentId;
+        uint32_t stat;
+        const BlockRef* ref;
+        uint32_t row;
+    };
+    std::vector<RowRef> rows;
+    std::vector<uint32_t> rowStats;
+    std::vector<char> column;
+
+    size_t next;
+    for ( size_t first = 0; first < blocks.size(); first = next ) {
+        rows.clear();
+        for ( next = first; next < blocks.size() && blocks[next].time == blocks[first].time &&
+                  blocks[next].table == blocks[first].table; next++ ) {
+            const BlockRef& ref = blocks[next];
+            for ( uint32_t row = 0; row < ref.block->numRows; row++ ) {
+                uint32_t stat = shardStatBase[ref.shard] + ref.block->stats[row];
+                rows.push_back({stats[stat].componentId, stat, &ref, row});
+            }
+        }
+        std::stable_sort(rows.begin(), rows.end(), [](const RowRef& a, const RowRef& b) {
+            return a.componentId < b.componentId;
+        });
+
+        const std::vector<uint32_t>& table = tables[blocks[first].table];
+        BlockHeader bh;
+        bh.numRows = rows.size();
+        bh.simTime = blocks[first].time;
+        bh.table = blocks[first].table;
+        bh.size = sizeof(bh) + padTo8(bh.numRows * sizeof(uint32_t));
+        for ( uint32_t field : table ) {
+            bh.size += padTo8(bh.numRows * fieldWidth(fields[field].type));
+        }
+        fwrite(&bh, sizeof(bh), 1, out);
+
+        rowStats.clear();
+        for ( auto& row : rows ) rowStats.push_back(row.stat);
+        fwrite(rowStats.data(), sizeof(uint32_t), rowStats.size(), out);
+        write_padding(out, rowStats.size() * sizeof(uint32_t));
+
+        // Columns of the merged table are in the same order as in each shard
+        for ( size_t c = 0; c < table.size(); c++ ) {
+            size_t width = fieldWidth(fields[table[c]].type);
+            column.resize(rows.size() * width);
+            for ( size_t r = 0; r < rows.size(); r++ ) {
+                const char* src = static_cast<const char*>(rows[r].ref->block->columns[c]);
+                memcpy(&column[r * width], src + rows[r].row * width, width);
+            }
+            fwrite(column.data(), 1, column.size(), out);
+            write_padding(out, column.size());
+        }
+    }
+    fclose(out);
+}
+
+
+int main(int argc, char* argv[]) {
+    std::string indexPath;
+    std::string outPath;
+
+    for ( int i = 1; i < argc; i++ ) {
+        if ( strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-help") == 0 ) {
+            print_usage(stdout);
+        } else if ( strcmp(argv[i], "-o") == 0 && i + 1 < argc ) {
+            outPath = argv[++i];
+        } else if ( indexPath.empty() && argv[i][0] != '-' ) {
+            indexPath = argv[i];
+        } else {
+            print_usage(stderr);
+        }
+    }
+    if ( indexPath.empty() ) print_usage(stderr);
+
+    if ( outPath.empty() ) {
+        const std::string suffix = ".index";
+        if ( indexPath.length() <= suffix.length() ||
+             indexPath.compare(indexPath.length() - suffix.length(), suffix.length(), suffix) != 0 ) {
+            fatal("%s does not end in .index, use -o to name the output", indexPath);
+        }
+        outPath = indexPath.substr(0, indexPath.length() - suffix.length());
+    }
+
+    RankIndex index;
+    read_index(indexPath, index);
+
+    if ( index.format == "csv" ) merge_csv(index, outPath);
+    else if ( index.format == "json" ) merge_json(index, outPath);
+    else if ( index.format == "binary" ) merge_binary(index, outPath);
+    else fatal("Unknown format '%s'", index.format);
+
+    return 0;
+}
@@ -89,6 +89,51 @@ protected:
       m_max = ( value > m_max ) ? value : m_max;
     }
 
+    /**
+        Present an array of values.  Each of the four lanes keeps its own
+        sums, minimum and maximum so the loop has no dependency between
+        consecutive values and the compiler can vectorize it.
+    */
+    void addData_impl_bulk(const NumberBase* data, size_t count) override
+    {
+        const size_t lanes = 4;
+        NumberBase sum[lanes];
+        NumberBase sum_sq[lanes];
+        NumberBase min[lanes];
+        NumberBase max[lanes];
+        for ( size_t l = 0; l < lanes; l++ ) {
+            sum[l] = 0;
+            sum_sq[l] = 0;
+            min[l] = m_min;
+            max[l] = m_max;
+        }
+
+        size_t i = 0;
+        for ( ; i + lanes <= count; i += lanes ) {
+            for ( size_t l = 0; l < lanes; l++ ) {
+                NumberBase value = data[i + l];
+                sum[l] += value;
+                sum_sq[l] += value * value;
+                min[l] = ( value < min[l] ) ? value : min[l];
+                max[l] = ( value > max[l] ) ? value : max[l];
+            }
+        }
+        for ( ; i < count; i++ ) {
+            NumberBase value = data[i];
+            sum[0] += value;
+            sum_sq[0] += value * value;
+            min[0] = ( value < min[0] ) ? value : min[0];
+            max[0] = ( value > max[0] ) ? value : max[0];
+        }
+
+        for ( size_t l = 0; l < lanes; l++ ) {
+            m_sum += sum[l];
+            m_sum_sq += sum_sq[l];
+            m_min = ( min[l] < m_min ) ? min[l] : m_min;
+            m_max = ( max[l] > m_max ) ? max[l] : m_max;
+        }
+    }
+
 public:
     /**
         Provides the sum of the values presented so far.
@@ -173,6 +218,15 @@ public:
         this->setCollectionCount(0);
     }
     
+    void serializeStatisticData(SST::Core::Serialization::serializer& ser) override
+    {
+        StatisticBase::serializeStatisticData(ser);
+        ser & m_sum;
+        ser & m_sum_sq;
+        ser & m_min;
+        ser & m_max;
+    }
+
     void registerOutputFields(StatisticOutput* statOutput) override
     {
         h_sum   = statOutput->registerField<NumberBase>("Sum");
@@ -16,7 +16,9 @@
 #include "sst/core/statapi/stataccumulator.h"
 #include "sst/core/statapi/stathistogram.h"
 #include "sst/core/statapi/statnull.h"
+#include "sst/core/statapi/statpercentile.h"
 #include "sst/core/statapi/statuniquecount.h"
+#include "sst/core/statapi/statuniquecountapprox.h"
 #include "sst/core/statapi/statoutputconsole.h"
 #include "sst/core/statapi/statoutputcsv.h"
 #include "sst/core/statapi/statoutputjson.h"
@@ -64,6 +66,13 @@ void StatisticBase::setCollectionCount(uint64_t newCount)
     checkEventForOutput();
 }   
 
+void StatisticBase::serializeStatisticData(SST::Core::Serialization::serializer& ser)
+{
+    ser & m_currentCollectionCount;
+    ser & m_statEnabled;
+    ser & m_outputEnabled;
+}
+
 void StatisticBase::resetCollectionCount() 
 {
     m_currentCollectionCount = 0;
@@ -184,6 +193,13 @@ SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, uint64_t);
 SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, float);
 SST_ELI_INSTANTIATE_STATISTIC(HistogramStatistic, double);
 
+SST_ELI_INSTANTIATE_STATISTIC(PercentileStatistic, int32_t);
+SST_ELI_INSTANTIATE_STATISTIC(PercentileStatistic, uint32_t);
+SST_ELI_INSTANTIATE_STATISTIC(PercentileStatistic, int64_t);
+SST_ELI_INSTANTIATE_STATISTIC(PercentileStatistic, uint64_t);
+SST_ELI_INSTANTIATE_STATISTIC(PercentileStatistic, float);
+SST_ELI_INSTANTIATE_STATISTIC(PercentileStatistic, double);
+
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, int32_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, uint32_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, int64_t);
@@ -191,6 +207,13 @@ SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, uint64_t);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, float);
 SST_ELI_INSTANTIATE_STATISTIC(UniqueCountStatistic, double);
 
+SST_ELI_INSTANTIATE_STATISTIC(UniqueCountApproxStatistic, int32_t);
+SST_ELI_INSTANTIATE_STATISTIC(UniqueCountApproxStatistic, uint32_t);
+SST_ELI_INSTANTIATE_STATISTIC(UniqueCountApproxStatistic, int64_t);
+SST_ELI_INSTANTIATE_STATISTIC(UniqueCountApproxStatistic, uint64_t);
+SST_ELI_INSTANTIATE_STATISTIC(UniqueCountApproxStatistic, float);
+SST_ELI_INSTANTIATE_STATISTIC(UniqueCountApproxStatistic, double);
+
 } //namespace Statistics
 } //namespace SST
 
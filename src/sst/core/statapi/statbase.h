@@ -178,6 +178,10 @@ public:
     /** Indicate if the Statistic is a NullStatistic */
     virtual bool isNullStatistic() const {return false;} 
 
+    /** Save or restore the collected data in a checkpoint.  Statistics
+     *  that keep data override this and call the base version first. */
+    virtual void serializeStatisticData(SST::Core::Serialization::serializer& ser);
+
 protected:
     friend class SST::Statistics::StatisticProcessingEngine;
     friend class SST::Statistics::StatisticOutput;
@@ -309,6 +313,18 @@ struct StatisticCollector<T,true> {
       addData_impl(data);
     }
   }
+
+  /**
+  * @brief addData_impl_bulk Add an array of values
+  *        By default, this just calls the addData function for each value
+  * @param data  The values
+  * @param count The number of values
+  */
+  virtual void addData_impl_bulk(const T* data, size_t count){
+    for (size_t i=0; i < count; ++i){
+      addData_impl(data[i]);
+    }
+  }
 };
 
 template <class... Args>
@@ -383,6 +399,18 @@ class Statistic : public StatisticBase, public StatisticCollector<T>
     }
 
 
+    /** Add an array of values to the Statistic in one call.  Only
+      * available for statistics of fundamental types.
+      */
+    void addDataBulk(const T* data, size_t count)
+    {
+        if (isEnabled()) {
+            this->addData_impl_bulk(data, count);
+            incrementCollectionCount(count);
+        }
+    }
+
+
     static fieldType_t fieldId() {
       return StatisticFieldType<T>::id();
     }
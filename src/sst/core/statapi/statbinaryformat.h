@@ -0,0 +1,116 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_CORE_STATISTICS_BINARYFORMAT
+#define _H_SST_CORE_STATISTICS_BINARYFORMAT
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SST {
+namespace Statistics {
+namespace BinaryFormat {
+
+/*
+ * Layout of the files written by StatisticOutputBinary.  Everything is
+ * in the byte order of the machine that wrote the file, and every
+ * section starts on an 8 byte boundary so that a reader can use the
+ * columns of a memory mapped file in place.
+ *
+ *   FileHeader
+ *   Field registry, numFields entries:
+ *       uint32_t type, string statName, string fieldName
+ *   Table registry, numTables entries (a table is the set of fields
+ *   output by a statistic; statistics of the same kind share one):
+ *       uint32_t numColumns, uint32_t field[numColumns]
+ *   Statistic registry, numStats entries:
+ *       uint32_t table, int32_t rank, uint64_t componentId,
+ *       string component, string statName, string subId, string statType
+ *   Blocks, up to the end of the file:
+ *       BlockHeader
+ *       uint32_t stat[numRows]
+ *       for each column of the table: value[numRows]
+ *
+ * Strings are a uint32_t length followed by the characters, and each
+ * registry entry, the stat array and every column are padded to 8
+ * bytes.  A block holds the entries of one table output at one
+ * simulation time.
+ */
+
+static const char     MAGIC[8] = { 'S', 'S', 'T', 'S', 'T', 'A', 'T', 'B' };
+static const uint32_t VERSION = 1;
+static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+enum FieldType : uint32_t {
+    INT32 = 1,
+    UINT32,
+    INT64,
+    UINT64,
+    FLOAT,
+    DOUBLE
+};
+
+struct FileHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    int32_t  rank;          /* -1 if the file holds several ranks */
+    uint32_t numFields;
+    uint32_t numTables;
+    uint32_t numStats;
+    uint64_t dataOffset;    /* Offset of the first block */
+};
+
+struct BlockHeader {
+    uint64_t size;          /* Size of the block, including this header */
+    uint64_t simTime;
+    uint32_t table;
+    uint32_t numRows;
+};
+
+/** Size in bytes of a value of the given type, 0 if unknown */
+inline size_t fieldWidth(uint32_t type)
+{
+    switch ( type ) {
+    case INT32:
+    case UINT32:
+    case FLOAT:
+        return 4;
+    case INT64:
+    case UINT64:
+    case DOUBLE:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+/** Short name of the given type, matching StatisticFieldInfo */
+inline const char* fieldShortName(uint32_t type)
+{
+    switch ( type ) {
+    case INT32:  return "i32";
+    case UINT32: return "u32";
+    case INT64:  return "i64";
+    case UINT64: return "u64";
+    case FLOAT:  return "f32";
+    case DOUBLE: return "f64";
+    default:     return "unknown";
+    }
+}
+
+inline size_t padTo8(size_t n) { return (n + 7) & ~(size_t)7; }
+
+} //namespace BinaryFormat
+} //namespace Statistics
+} //namespace SST
+
+#endif
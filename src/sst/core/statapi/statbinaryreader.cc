@@ -0,0 +1,201 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "sst/core/statapi/statbinaryreader.h"
+
+#include "sst/core/stringize.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace SST {
+namespace Statistics {
+
+using namespace BinaryFormat;
+
+StatisticBinaryReader::StatisticBinaryReader() :
+    m_data(nullptr),
+    m_size(0),
+    m_rank(0)
+{
+}
+
+StatisticBinaryReader::~StatisticBinaryReader()
+{
+    close();
+}
+
+bool StatisticBinaryReader::fail(const std::string& msg)
+{
+    m_error = msg;
+    close();
+    return false;
+}
+
+bool StatisticBinaryReader::readString(size_t& offset, std::string& str)
+{
+    uint32_t len;
+    if ( offset + sizeof(len) > m_size ) return false;
+    memcpy(&len, m_data + offset, sizeof(len));
+    offset += sizeof(len);
+    if ( offset + len > m_size ) return false;
+    str.assign(m_data + offset, len);
+    offset += len;
+    return true;
+}
+
+bool StatisticBinaryReader::open(const std::string& path)
+{
+    close();
+    m_error.clear();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if ( fd < 0 ) return fail(path + ": " + strerror(errno));
+
+    struct stat st;
+    if ( fstat(fd, &st) != 0 ) {
+        ::close(fd);
+        return fail(path + ": " + strerror(errno));
+    }
+    m_size = st.st_size;
+    if ( m_size < sizeof(FileHeader) ) {
+        ::close(fd);
+        return fail(path + ": not a statistic binary file");
+    }
+
+    void* map = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if ( map == MAP_FAILED ) return fail(path + ": " + strerror(errno));
+    m_data = static_cast<const char*>(map);
+
+    const FileHeader* header = reinterpret_cast<const FileHeader*>(m_data);
+    if ( memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 ) {
+        return fail(path + ": not a statistic binary file");
+    }
+    if ( header->byteOrder != BYTE_ORDER_MARK ) {
+        return fail(path + ": written on a machine with a different byte order");
+    }
+    if ( header->version != VERSION ) {
+        return fail(path + ": unsupported version " + SST::to_string(header->version));
+    }
+    m_rank = header->rank;
+
+    /* Registries */
+    size_t offset = sizeof(FileHeader);
+    const std::string truncated = path + ": file is truncated";
+
+    m_fields.resize(header->numFields);
+    for ( Field& field : m_fields ) {
+        size_t start = offset;
+        if ( offset + sizeof(uint32_t) > m_size ) return fail(truncated);
+        memcpy(&field.type, m_data + offset, sizeof(uint32_t));
+        offset += sizeof(uint32_t);
+        if ( !readString(offset, field.statName) || !readString(offset, field.fieldName) ) return fail(truncated);
+        if ( fieldWidth(field.type) == 0 ) return fail(path + ": unknown field type");
+        offset = start + padTo8(offset - start);
+    }
+
+    m_tables.resize(header->numTables);
+    for ( Table& table : m_tables ) {
+        uint32_t numColumns;
+        if ( offset + sizeof(uint32_t) > m_size ) return fail(truncated);
+        memcpy(&numColumns, m_data + offset, sizeof(uint32_t));
+        if ( numColumns > m_size / sizeof(uint32_t) ) return fail(truncated);
+        size_t size = ((size_t)numColumns + 1) * sizeof(uint32_t);
+        if ( offset + size > m_size ) return fail(truncated);
+        table.fields.resize(numColumns);
+        memcpy(table.fields.data(), m_data + offset + sizeof(uint32_t), numColumns * sizeof(uint32_t));
+        for ( uint32_t field : table.fields ) {
+            if ( field >= m_fields.size() ) return fail(path + ": bad field index in table");
+        }
+        offset += padTo8(size);
+    }
+
+    m_stats.resize(header->numStats);
+    for ( Stat& stat : m_stats ) {
+        size_t start = offset;
+        if ( offset + 2 * sizeof(uint32_t) + sizeof(uint64_t) > m_size ) return fail(truncated);
+        memcpy(&stat.table, m_data + offset, sizeof(uint32_t));
+        memcpy(&stat.rank, m_data + offset + sizeof(uint32_t), sizeof(int32_t));
+        memcpy(&stat.componentId, m_data + offset + 2 * sizeof(uint32_t), sizeof(uint64_t));
+        offset += 2 * sizeof(uint32_t) + sizeof(uint64_t);
+        if ( !readString(offset, stat.component) || !readString(offset, stat.statName) ||
+             !readString(offset, stat.subId) || !readString(offset, stat.statType) ) return fail(truncated);
+        if ( stat.table >= m_tables.size() ) return fail(path + ": bad table index in statistic");
+        offset = start + padTo8(offset - start);
+    }
+
+    if ( header->dataOffset != offset ) return fail(path + ": corrupt registry");
+
+    /* Blocks.  Only the headers are read. */
+    while ( offset < m_size ) {
+        if ( offset + sizeof(BlockHeader) > m_size ) return fail(truncated);
+        const BlockHeader* bh = reinterpret_cast<const BlockHeader*>(m_data + offset);
+        if ( bh->table >= m_tables.size() ) return fail(path + ": bad table index in block");
+        if ( offset + bh->size > m_size ) return fail(truncated);
+
+        m_blocks.emplace_back();
+        Block& block = m_blocks.back();
+        block.simTime = bh->simTime;
+        block.table = bh->table;
+        block.numRows = bh->numRows;
+
+        size_t pos = offset + sizeof(BlockHeader);
+        block.stats = reinterpret_cast<const uint32_t*>(m_data + pos);
+        pos += padTo8(bh->numRows * sizeof(uint32_t));
+        for ( uint32_t field : m_tables[bh->table].fields ) {
+            block.columns.push_back(m_data + pos);
+            pos += padTo8(bh->numRows * fieldWidth(m_fields[field].type));
+        }
+        if ( pos != offset + bh->size ) return fail(path + ": corrupt block");
+        for ( uint32_t row = 0; row < block.numRows; row++ ) {
+            if ( block.stats[row] >= m_stats.size() ) return fail(path + ": bad statistic index in block");
+        }
+        offset = pos;
+    }
+
+    return true;
+}
+
+void StatisticBinaryReader::close()
+{
+    if ( m_data != nullptr ) {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_fields.clear();
+    m_tables.clear();
+    m_stats.clear();
+    m_blocks.clear();
+}
+
+double StatisticBinaryReader::getValue(const Block& block, size_t column, size_t row) const
+{
+    switch ( m_fields[m_tables[block.table].fields[column]].type ) {
+    case INT32:  return block.getColumn<int32_t>(column)[row];
+    case UINT32: return block.getColumn<uint32_t>(column)[row];
+    case INT64:  return block.getColumn<int64_t>(column)[row];
+    case UINT64: return block.getColumn<uint64_t>(column)[row];
+    case FLOAT:  return block.getColumn<float>(column)[row];
+    case DOUBLE: return block.getColumn<double>(column)[row];
+    default:     return 0.0;
+    }
+}
+
+} //namespace Statistics
+} //namespace SST
@@ -0,0 +1,108 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_CORE_STATISTICS_BINARYREADER
+#define _H_SST_CORE_STATISTICS_BINARYREADER
+
+#include "sst/core/statapi/statbinaryformat.h"
+
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class StatisticBinaryReader
+
+    Reads files written by StatisticOutputBinary.  The file is memory
+    mapped and only the registries and block headers are parsed; the
+    stat indexes and columns of each block are used in place.  Does not
+    depend on the rest of the core, so analysis tools can link it alone.
+*/
+class StatisticBinaryReader
+{
+public:
+    struct Field {
+        uint32_t    type;
+        std::string statName;
+        std::string fieldName;
+    };
+
+    struct Table {
+        std::vector<uint32_t> fields;
+    };
+
+    struct Stat {
+        uint32_t    table;
+        int32_t     rank;
+        uint64_t    componentId;
+        std::string component;
+        std::string statName;
+        std::string subId;
+        std::string statType;
+    };
+
+    /** Entries of one table output at one simulation time */
+    struct Block {
+        uint64_t        simTime;
+        uint32_t        table;
+        uint32_t        numRows;
+        /** Index into getStats() of the statistic of each row */
+        const uint32_t* stats;
+        /** One column of numRows values per field of the table */
+        std::vector<const void*> columns;
+
+        template<typename T>
+        const T* getColumn(size_t column) const { return static_cast<const T*>(columns[column]); }
+    };
+
+    StatisticBinaryReader();
+    ~StatisticBinaryReader();
+
+    /** Map and index a file
+     * @return False if the file could not be read, see getError()
+     */
+    bool open(const std::string& path);
+    void close();
+
+    const std::string& getError() const { return m_error; }
+
+    /** Rank that wrote the file, -1 for a merged file */
+    int getRank() const { return m_rank; }
+
+    const std::vector<Field>& getFields() const { return m_fields; }
+    const std::vector<Table>& getTables() const { return m_tables; }
+    const std::vector<Stat>& getStats() const { return m_stats; }
+    const std::vector<Block>& getBlocks() const { return m_blocks; }
+
+    /** Get a value of any type as a double */
+    double getValue(const Block& block, size_t column, size_t row) const;
+
+private:
+    bool fail(const std::string& msg);
+    bool readString(size_t& offset, std::string& str);
+
+    std::string         m_error;
+    const char*         m_data;
+    size_t              m_size;
+    int                 m_rank;
+
+    std::vector<Field>  m_fields;
+    std::vector<Table>  m_tables;
+    std::vector<Stat>   m_stats;
+    std::vector<Block>  m_blocks;
+};
+
+} //namespace Statistics
+} //namespace SST
+
+#endif
@@ -177,6 +177,7 @@ void StatisticProcessingEngine::startOfSimulation()
 
     for ( auto &so : m_statOutputs ) {
         so->startOfSimulation();
+        so->startAsyncOutput();
     }
 }
 
@@ -213,6 +214,8 @@ void StatisticProcessingEngine::endOfSimulation()
 
 
     for ( auto &so : m_statOutputs ) {
+        // Write out anything still queued before the output shuts down
+        so->stopAsyncOutput();
         so->endOfSimulation();
     }
 }
@@ -278,8 +281,12 @@ bool StatisticProcessingEngine::addPeriodicBasedStatistic(const UnitAlgebra& fre
     Clock::HandlerBase* ClockHandler;
     StatArray_t*        statArray;
 
+    // Each thread outputs the statistics of its own components from its own
+    // clock, so a statistic is only ever touched by the thread that owns it
+    auto key = std::make_pair(tcFactor, sim->getRank().thread);
+
     // See if the map contains an entry for this factor
-    if (m_PeriodicStatisticMap.find(tcFactor) == m_PeriodicStatisticMap.end() ) {
+    if (m_PeriodicStatisticMap.find(key) == m_PeriodicStatisticMap.end() ) {
 
         // Check to see if the freq is zero.  Only add a new clock if the freq is non zero
         if (0 != freq.getValue()) {
@@ -295,11 +302,11 @@ bool StatisticProcessingEngine::addPeriodicBasedStatistic(const UnitAlgebra& fre
 
         // Also create a new Array of Statistics and relate it to the map
         statArray = new std::vector<StatisticBase*>();
-        m_PeriodicStatisticMap[tcFactor] = statArray;
+        m_PeriodicStatisticMap[key] = statArray;
     }
 
     // The Statistic Map has the time factor registered.
-    statArray = m_PeriodicStatisticMap[tcFactor];
+    statArray = m_PeriodicStatisticMap[key];
 
     // Add the statistic to the lists of statistics to be called when the clock fires.
     statArray->push_back(stat);
@@ -484,7 +491,7 @@ void StatisticProcessingEngine::performGlobalStatisticOutput(bool endOfSimFlag /
     }
 
     // Output Periodic based statistics 
-    for (StatMap_t::iterator it_m = m_PeriodicStatisticMap.begin(); it_m != m_PeriodicStatisticMap.end(); it_m++) {
+    for (PeriodicStatMap_t::iterator it_m = m_PeriodicStatisticMap.begin(); it_m != m_PeriodicStatisticMap.end(); it_m++) {
         statArray = it_m->second;
 
         for (StatArray_t::iterator it_v = statArray->begin(); it_v != statArray->end(); it_v++) {
@@ -507,8 +514,8 @@ bool StatisticProcessingEngine::handleStatisticEngineClockEvent(Cycle_t UNUSED(C
     StatisticBase*   stat;
     unsigned int     x;
 
-    // Get the array for the timeFactor
-    statArray = m_PeriodicStatisticMap[timeFactor];
+    // Get the array for the timeFactor on this thread
+    statArray = m_PeriodicStatisticMap[std::make_pair(timeFactor, Simulation::getSimulation()->getRank().thread)];
     
     // Walk the array, and call the output method of each statistic
     for (x = 0; x < statArray->size(); x++) {
@@ -525,10 +532,15 @@ bool StatisticProcessingEngine::handleStatisticEngineClockEvent(Cycle_t UNUSED(C
 
 bool StatisticProcessingEngine::handleGroupClockEvent(Cycle_t UNUSED(CycleNum), StatisticGroup *group)
 {
+    // Threads that sync without barriers may be waiting on this one
+    // to reach the same cycle
+    Simulation* sim = Simulation::getSimulation();
+    sim->publishSafeTime();
     m_barrier.wait();
-    if ( Simulation::getSimulation()->getRank().thread == 0 ) {
+    if ( sim->getRank().thread == 0 ) {
         performStatisticGroupOutputImpl(*group, false);
     }
+    sim->publishSafeTime();
     m_barrier.wait();
     return false;
 }
@@ -602,6 +614,34 @@ StatisticProcessingEngine::isStatisticInCompStatMap(const std::string& compName,
     return nullptr;
 }
 
+void
+StatisticProcessingEngine::serializeComponentStatistics(ComponentId_t compId, SST::Core::Serialization::serializer& ser)
+{
+    // Only reads the map, so threads can do this for their own
+    // components at the same time
+    auto it = m_CompStatMap.find(compId);
+    uint32_t registered = ( it == m_CompStatMap.end() ) ? 0 : it->second->size();
+    uint32_t count = registered;
+    ser & count;
+    if ( count != registered ) {
+        m_output.fatal(CALL_INFO, 1, "Checkpoint has %" PRIu32 " statistics for component %" PRIu64 ", but it registered %" PRIu32 "\n",
+                count, compId, registered);
+    }
+    if ( 0 == count ) return;
+
+    for ( StatisticBase* stat : *it->second ) {
+        std::string name = stat->getStatName();
+        std::string subId = stat->getStatSubId();
+        ser & name;
+        ser & subId;
+        if ( name != stat->getStatName() || subId != stat->getStatSubId() ) {
+            m_output.fatal(CALL_INFO, 1, "Checkpoint has statistic %s.%s where component %" PRIu64 " registered %s\n",
+                    name.c_str(), subId.c_str(), compId, stat->getFullStatName().c_str());
+        }
+        stat->serializeStatisticData(ser);
+    }
+}
+
 void StatisticProcessingEngine::addStatisticToCompStatMap(StatisticBase* Stat,
            StatisticFieldInfo::fieldType_t UNUSED(fieldType))
 {
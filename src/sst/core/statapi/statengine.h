@@ -136,15 +136,18 @@ private:
                                             const std::string& statName, const std::string& statSubId,
                                             StatisticFieldInfo::fieldType_t fieldType);
     void addStatisticToCompStatMap(StatisticBase* Stat, StatisticFieldInfo::fieldType_t fieldType);
+    /** Save or restore the data of the statistics a component registered */
+    void serializeComponentStatistics(ComponentId_t compId, SST::Core::Serialization::serializer& ser);
     void castError(const std::string& type, const std::string& statName, const std::string& fieldName);
 
 private:
     typedef std::vector<StatisticBase*>           StatArray_t;       /*!< Array of Statistics */
     typedef std::map<SimTime_t, StatArray_t*>     StatMap_t;         /*!< Map of simtimes to Statistic Arrays */
+    typedef std::map<std::pair<SimTime_t, uint32_t>, StatArray_t*> PeriodicStatMap_t; /*!< Map of simtimes and threads to Statistic Arrays */
     typedef std::map<ComponentId_t, StatArray_t*> CompStatMap_t;     /*!< Map of ComponentId's to StatInfo Arrays */
 
     StatArray_t                               m_EventStatisticArray;  /*!< Array of Event Based Statistics */
-    StatMap_t                                 m_PeriodicStatisticMap; /*!< Map of Array's of Periodic Based Statistics */
+    PeriodicStatMap_t                         m_PeriodicStatisticMap; /*!< Map of Array's of Periodic Based Statistics, per thread */
     StatMap_t                                 m_StartTimeMap;         /*!< Map of Array's of Statistics that are started at a sim time */
     StatMap_t                                 m_StopTimeMap;          /*!< Map of Array's of Statistics that are stopped at a sim time */
     CompStatMap_t                             m_CompStatMap;          /*!< Map of Arrays of Statistics tied to Component Id's */  
@@ -136,6 +136,40 @@ protected:
       addData_impl_Ntimes(1, value);
     }
 
+    /**
+        Adds an array of values.  Consecutive values often fall in the same
+        bin, so the last bin used is kept instead of searching the map for
+        every value.
+    */
+    void addData_impl_bulk(const BinDataType* data, size_t count) override
+    {
+        BinDataType minValue = getBinsMinValue();
+        BinDataType maxValue = getBinsMaxValue();
+        HistoMapItr_t bin_itr = m_binsMap.end();
+
+        for (size_t i = 0; i < count; i++) {
+            BinDataType value = data[i];
+            if (value < minValue) {
+                m_OOBMinCount++;
+                continue;
+            }
+            if (value > maxValue) {
+                m_OOBMaxCount++;
+                continue;
+            }
+
+            m_totalSummed += value;
+            m_totalSummedSqr += (value * value);
+            m_itemsBinnedCount++;
+
+            BinDataType bin_start = (BinDataType)(m_binWidth * floor((double)value / (double)m_binWidth));
+            if (bin_itr == m_binsMap.end() || bin_itr->first != bin_start) {
+                bin_itr = m_binsMap.insert(std::pair<BinDataType, CountType>(bin_start, (CountType) 0)).first;
+            }
+            bin_itr->second++;
+        }
+    }
+
 private:    
     /** Count how many bins are active in this histogram */
     NumBinsType getActiveBinCount() 
@@ -238,6 +272,17 @@ private:
         m_binsMap.clear();
         this->setCollectionCount(0);
     }
+
+    void serializeStatisticData(SST::Core::Serialization::serializer& ser) override
+    {
+        StatisticBase::serializeStatisticData(ser);
+        ser & m_OOBMinCount;
+        ser & m_OOBMaxCount;
+        ser & m_itemsBinnedCount;
+        ser & m_totalSummed;
+        ser & m_totalSummedSqr;
+        ser & m_binsMap;
+    }
     
     void registerOutputFields(StatisticOutput* statOutput) override
     {
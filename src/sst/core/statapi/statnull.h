@@ -54,6 +54,8 @@ struct NullStatisticBase<T,true> : public Statistic<T> {
   void addData_impl(T UNUSED(data)) override {}
 
   void addData_impl_Ntimes(uint64_t UNUSED(N), T UNUSED(data)) override {}
+
+  void addData_impl_bulk(const T* UNUSED(data), size_t UNUSED(count)) override {}
 };
 
 template <class... Args>
@@ -104,7 +106,11 @@ struct NullStatistic : public NullStatisticBase<T> {
   NullStatistic(BaseComponent* comp, const std::string& statName,
                 const std::string& statSubId, Params& statParam)
       : NullStatisticBase<T>(comp, statName, statSubId, statParam)
-  {}
+  {
+      // A disabled statistic makes addData() an inlined test of the
+      // enable flag, with no virtual call or collection count update
+      this->disable();
+  }
 
   ~NullStatistic(){}
 
@@ -12,6 +12,9 @@
 #include "sst_config.h"
 #include "sst/core/statapi/statoutput.h"
 
+#include <cerrno>
+#include <cstring>
+
 #include "sst/core/output.h"
 #include "sst/core/statapi/statgroup.h"
 #include "sst/core/stringize.h"
@@ -22,6 +25,54 @@ namespace Statistics {
 
 ////////////////////////////////////////////////////////////////////////////////    
     
+/**
+ * Stands in for the output when a statistic outputs its data in async
+ * mode, and records the fields into the current batch.
+ */
+class StatisticOutput::AsyncRecorder : public StatisticOutput
+{
+public:
+    AsyncRecorder(StatisticOutput* owner) : StatisticOutput(), owner(owner) {}
+
+    void outputField(fieldHandle_t fieldHandle, int32_t data) override {
+        record(AsyncRecord::FIELD_INT32, fieldHandle).i32 = data;
+    }
+    void outputField(fieldHandle_t fieldHandle, uint32_t data) override {
+        record(AsyncRecord::FIELD_UINT32, fieldHandle).u32 = data;
+    }
+    void outputField(fieldHandle_t fieldHandle, int64_t data) override {
+        record(AsyncRecord::FIELD_INT64, fieldHandle).i64 = data;
+    }
+    void outputField(fieldHandle_t fieldHandle, uint64_t data) override {
+        record(AsyncRecord::FIELD_UINT64, fieldHandle).u64 = data;
+    }
+    void outputField(fieldHandle_t fieldHandle, float data) override {
+        record(AsyncRecord::FIELD_FLOAT, fieldHandle).f = data;
+    }
+    void outputField(fieldHandle_t fieldHandle, double data) override {
+        record(AsyncRecord::FIELD_DOUBLE, fieldHandle).d = data;
+    }
+
+protected:
+    bool checkOutputParameters() override { return true; }
+    void printUsage() override {}
+    void startOfSimulation() override {}
+    void endOfSimulation() override {}
+    void implStartOutputEntries(StatisticBase* UNUSED(statistic)) override {}
+    void implStopOutputEntries() override {}
+
+private:
+    decltype(AsyncRecord::data)& record(AsyncRecord::Kind kind, fieldHandle_t fieldHandle) {
+        std::vector<AsyncRecord>& records = owner->m_asyncBatch->records;
+        records.emplace_back();
+        records.back().kind = kind;
+        records.back().handle = fieldHandle;
+        return records.back().data;
+    }
+
+    StatisticOutput* owner;
+};
+
 StatisticOutput::StatisticOutput(Params& outputParameters)
  : Module()
 {
@@ -29,6 +80,14 @@ StatisticOutput::StatisticOutput(Params& outputParameters)
     m_outputParameters = outputParameters;
     m_highestFieldHandle = 0;
     m_currentFieldStatName = "";
+    m_entrySimTime = 0;
+    m_entryRank = 0;
+
+    m_async = outputParameters.find<bool>("async", false);
+    m_asyncMaxBatches = outputParameters.find<size_t>("asyncdepth", 4096);
+    m_asyncRecorder = nullptr;
+    m_asyncBatch = nullptr;
+    m_asyncStop = false;
 }
 
 SST_ELI_DEFINE_CTOR_EXTERN(StatisticOutput)
@@ -36,6 +95,11 @@ SST_ELI_DEFINE_INFO_EXTERN(StatisticOutput)
 
 StatisticOutput::~StatisticOutput()
 {
+    stopAsyncOutput();
+    delete m_asyncRecorder;
+    for ( auto batch : m_asyncFree ) {
+        delete batch;
+    }
 }
 
 void StatisticOutput::registerStatistic(StatisticBase *stat)
@@ -167,6 +231,19 @@ StatisticOutput::outputField(fieldHandle_t UNUSED(fieldHandle), uint64_t UNUSED(
 void StatisticOutput::outputEntries(StatisticBase* statistic, bool endOfSimFlag)
 {
     this->lock();
+    if ( m_asyncRecorder != nullptr ) {
+        bool started = beginAsyncBatch();
+        m_asyncBatch->add(AsyncRecord::START_ENTRIES, statistic);
+        statistic->outputStatisticData(m_asyncRecorder, endOfSimFlag);
+        m_asyncBatch->add(AsyncRecord::STOP_ENTRIES, nullptr);
+        if ( started ) pushAsyncBatch();
+        this->unlock();
+        return;
+    }
+
+    Simulation* sim = Simulation::getSimulation();
+    m_entrySimTime = sim->getCurrentSimCycle();
+    m_entryRank = sim->getRank().rank;
     startOutputEntries(statistic);
     statistic->outputStatisticData(this, endOfSimFlag);
     stopOutputEntries();
@@ -192,6 +269,21 @@ void StatisticOutput::stopOutputEntries()
 void StatisticOutput::outputGroup(StatisticGroup* group, bool endOfSimFlag)
 {
     this->lock();
+    if ( m_asyncRecorder != nullptr ) {
+        bool started = beginAsyncBatch();
+        m_asyncBatch->add(AsyncRecord::START_GROUP, group);
+        for ( auto & stat : group->stats ) {
+            outputEntries(stat, endOfSimFlag);
+        }
+        m_asyncBatch->add(AsyncRecord::STOP_GROUP, nullptr);
+        if ( started ) pushAsyncBatch();
+        this->unlock();
+        return;
+    }
+
+    Simulation* sim = Simulation::getSimulation();
+    m_entrySimTime = sim->getCurrentSimCycle();
+    m_entryRank = sim->getRank().rank;
     startOutputGroup(group);
     for ( auto & stat : group->stats ) {
         outputEntries(stat, endOfSimFlag);
@@ -219,5 +311,182 @@ const char* StatisticOutput::getFieldTypeShortName(fieldType_t type)
     return StatisticFieldInfo::getFieldTypeShortName(type);
 }
 
+static std::string insertRank(const std::string& path, int rank)
+{
+    std::string rankPath = path;
+    std::string rankstr = "_" + SST::to_string(rank);
+
+    // Search for an extension in the file name, not the directories
+    size_t index = rankPath.find_last_of(".");
+    size_t slash = rankPath.find_last_of("/");
+    if (std::string::npos != index && (std::string::npos == slash || index > slash)) {
+        // We found a . at the end of the file, insert the rank string
+        rankPath.insert(index, rankstr);
+    } else {
+        // No . found, append the rank string
+        rankPath += rankstr;
+    }
+    return rankPath;
+}
+
+std::string StatisticOutput::getRankFilePath(const std::string& path) const
+{
+    Simulation* sim = Simulation::getSimulation();
+    if (1 < sim->getNumRanks().rank) {
+        return insertRank(path, sim->getRank().rank);
+    }
+    return path;
+}
+
+void StatisticOutput::writeRankIndex(const std::string& path, const std::string& format,
+                                     const std::map<std::string, std::string>& options)
+{
+    Simulation* sim = Simulation::getSimulation();
+    if (1 == sim->getNumRanks().rank || 0 != sim->getRank().rank) return;
+
+    std::string indexPath = path + ".index";
+    FILE* fp = fopen(indexPath.c_str(), "w");
+    if (nullptr == fp) {
+        Simulation::getSimulationOutput().fatal(CALL_INFO, 1,
+            " : %s - Problem opening File %s - %s\n", getStatisticOutputName().c_str(),
+            indexPath.c_str(), strerror(errno));
+    }
+
+    // Files are named relative to the index, so the set can be moved
+    fprintf(fp, "# SST statistic output index, combine the files with sst-stat-merge\n");
+    fprintf(fp, "format %s\n", format.c_str());
+    fprintf(fp, "ranks %u\n", sim->getNumRanks().rank);
+    for ( auto& opt : options ) {
+        fprintf(fp, "%s %s\n", opt.first.c_str(), opt.second.c_str());
+    }
+    for ( uint32_t rank = 0; rank < sim->getNumRanks().rank; rank++ ) {
+        std::string rankPath = insertRank(path, rank);
+        size_t slash = rankPath.find_last_of("/");
+        if (std::string::npos != slash) rankPath.erase(0, slash + 1);
+        fprintf(fp, "rank %u %s\n", rank, rankPath.c_str());
+    }
+    fclose(fp);
+}
+
+void StatisticOutput::startAsyncOutput()
+{
+    if ( !m_async ) return;
+    m_asyncRecorder = new AsyncRecorder(this);
+    m_asyncStop = false;
+    m_asyncThread = std::thread(&StatisticOutput::asyncWriter, this);
+}
+
+void StatisticOutput::stopAsyncOutput()
+{
+    if ( !m_asyncThread.joinable() ) return;
+    {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+        m_asyncStop = true;
+    }
+    m_asyncReady.notify_one();
+    m_asyncThread.join();
+
+    // Anything output from here on is written directly
+    delete m_asyncRecorder;
+    m_asyncRecorder = nullptr;
+}
+
+bool StatisticOutput::beginAsyncBatch()
+{
+    if ( m_asyncBatch != nullptr ) return false;
+
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+    // Don't let the simulation get too far ahead of the writer
+    m_asyncSpace.wait(lock, [this]() { return m_asyncQueue.size() < m_asyncMaxBatches; });
+    if ( m_asyncFree.empty() ) {
+        m_asyncBatch = new AsyncBatch();
+    }
+    else {
+        m_asyncBatch = m_asyncFree.back();
+        m_asyncFree.pop_back();
+    }
+    lock.unlock();
+
+    Simulation* sim = Simulation::getSimulation();
+    m_asyncBatch->time = sim->getCurrentSimCycle();
+    m_asyncBatch->rank = sim->getRank().rank;
+    return true;
+}
+
+void StatisticOutput::pushAsyncBatch()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+        m_asyncQueue.push_back(m_asyncBatch);
+    }
+    m_asyncBatch = nullptr;
+    m_asyncReady.notify_one();
+}
+
+void StatisticOutput::asyncWriter()
+{
+    std::deque<AsyncBatch*> work;
+    std::unique_lock<std::mutex> lock(m_asyncMutex);
+    while ( true ) {
+        m_asyncReady.wait(lock, [this]() { return !m_asyncQueue.empty() || m_asyncStop; });
+        // Only stop once everything queued has been written
+        if ( m_asyncQueue.empty() ) break;
+        work.swap(m_asyncQueue);
+        lock.unlock();
+        m_asyncSpace.notify_all();
+
+        for ( auto batch : work ) {
+            replayAsyncBatch(batch);
+        }
+
+        lock.lock();
+        for ( auto batch : work ) {
+            batch->records.clear();
+            m_asyncFree.push_back(batch);
+        }
+        work.clear();
+    }
+}
+
+void StatisticOutput::replayAsyncBatch(AsyncBatch* batch)
+{
+    m_entrySimTime = batch->time;
+    m_entryRank = batch->rank;
+    for ( auto & rec : batch->records ) {
+        switch ( rec.kind ) {
+        case AsyncRecord::START_GROUP:
+            startOutputGroup(static_cast<StatisticGroup*>(rec.data.ptr));
+            break;
+        case AsyncRecord::STOP_GROUP:
+            stopOutputGroup();
+            break;
+        case AsyncRecord::START_ENTRIES:
+            startOutputEntries(static_cast<StatisticBase*>(rec.data.ptr));
+            break;
+        case AsyncRecord::STOP_ENTRIES:
+            stopOutputEntries();
+            break;
+        case AsyncRecord::FIELD_INT32:
+            outputField(rec.handle, rec.data.i32);
+            break;
+        case AsyncRecord::FIELD_UINT32:
+            outputField(rec.handle, rec.data.u32);
+            break;
+        case AsyncRecord::FIELD_INT64:
+            outputField(rec.handle, rec.data.i64);
+            break;
+        case AsyncRecord::FIELD_UINT64:
+            outputField(rec.handle, rec.data.u64);
+            break;
+        case AsyncRecord::FIELD_FLOAT:
+            outputField(rec.handle, rec.data.f);
+            break;
+        case AsyncRecord::FIELD_DOUBLE:
+            outputField(rec.handle, rec.data.d);
+            break;
+        }
+    }
+}
+
 } //namespace Statistics
 } //namespace SST
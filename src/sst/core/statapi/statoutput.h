@@ -21,7 +21,11 @@
 #include "sst/core/eli/elementinfo.h"
 #include <unordered_map>
 
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <mutex>
+#include <thread>
 
 // Default Settings for Statistic Output and Load Level
 #define STATISTICSDEFAULTOUTPUTNAME "sst.statOutputConsole"
@@ -44,6 +48,13 @@ class StatisticGroup;
   the derived output object either periodically or by event and/or also at
   the end of the simulation.  A single statistic output will be created by the
   simulation (per node) and will collect the data per its design.
+
+  If the "async" parameter is set, the simulation threads only record the
+  field values of each output into a binary batch, and a writer thread
+  started at the beginning of the simulation feeds the batches through the
+  derived class, so formatting and file I/O happen off the simulation
+  threads.  Derived classes must then take the simulation time and rank of
+  an entry from getEntrySimTime() and getEntryRank().
 */
 class StatisticOutput : public Module
 {
@@ -234,18 +245,84 @@ private:
 
     void castError();
 
+    // Async output
+    void startAsyncOutput();
+    void stopAsyncOutput();
+    void asyncWriter();
+    /** Get a batch to record into, if one isn't already in progress
+     * @return True if the caller started the batch and must push it */
+    bool beginAsyncBatch();
+    void pushAsyncBatch();
+
+    class AsyncRecorder;
+
+    struct AsyncRecord {
+        enum Kind : uint8_t {
+            START_GROUP, STOP_GROUP, START_ENTRIES, STOP_ENTRIES,
+            FIELD_INT32, FIELD_UINT32, FIELD_INT64, FIELD_UINT64, FIELD_FLOAT, FIELD_DOUBLE
+        };
+        Kind kind;
+        fieldHandle_t handle;
+        union {
+            void*    ptr;
+            int32_t  i32;
+            uint32_t u32;
+            int64_t  i64;
+            uint64_t u64;
+            float    f;
+            double   d;
+        } data;
+    };
+
+    /* Everything recorded by one outputEntries() or outputGroup()
+     * call.  Batches are recycled, so once the records vectors have
+     * grown no more allocation is done. */
+    struct AsyncBatch {
+        SimTime_t time;
+        int rank;
+        std::vector<AsyncRecord> records;
+
+        void add(AsyncRecord::Kind kind, void* ptr) {
+            records.emplace_back();
+            records.back().kind = kind;
+            records.back().data.ptr = ptr;
+        }
+    };
+
+    void replayAsyncBatch(AsyncBatch* batch);
+
     // Other support functions
     StatisticFieldInfo* addFieldToLists(const char* fieldName, fieldType_t fieldType);
     fieldHandle_t generateFieldHandle(StatisticFieldInfo* FieldInfo);
 
 
 protected:
-    StatisticOutput() {;} // For serialization only
+    StatisticOutput() : m_async(false), m_asyncRecorder(nullptr), m_asyncBatch(nullptr), m_asyncStop(false) {;} // For serialization only
     void setStatisticOutputName(const std::string& name) {m_statOutputName = name;}
 
     void lock() { m_lock.lock(); }
     void unlock() { m_lock.unlock(); }
 
+    /** Simulation time of the entries being output */
+    SimTime_t getEntrySimTime() const { return m_entrySimTime; }
+    /** Rank the entries being output came from */
+    int getEntryRank() const { return m_entryRank; }
+
+    /** Path of the file this rank should write.  With more than one
+     * rank, "_<rank>" is inserted before the extension of path, or
+     * appended if it has none. */
+    std::string getRankFilePath(const std::string& path) const;
+
+    /** With more than one rank, have rank 0 write <path>.index, which
+     * names the file of every rank so that sst-stat-merge can combine
+     * them into one.
+     * @param path - The file path, before getRankFilePath()
+     * @param format - Format of the files: csv, json or binary
+     * @param options - Extra settings the merge tool needs to read the files
+     */
+    void writeRankIndex(const std::string& path, const std::string& format,
+                        const std::map<std::string, std::string>& options = std::map<std::string, std::string>());
+
 private:
     std::string      m_statOutputName;
     Params           m_outputParameters;
@@ -254,6 +331,22 @@ private:
     fieldHandle_t    m_highestFieldHandle;
     std::string      m_currentFieldStatName;
     std::recursive_mutex  m_lock;
+    SimTime_t        m_entrySimTime;
+    int              m_entryRank;
+
+    bool             m_async;
+    size_t           m_asyncMaxBatches;
+    AsyncRecorder*   m_asyncRecorder;
+    AsyncBatch*      m_asyncBatch;
+    std::thread      m_asyncThread;
+    std::mutex       m_asyncMutex;
+    /* Signals the writer that there are batches, or that it should stop */
+    std::condition_variable m_asyncReady;
+    /* Signals simulation threads that the writer has caught up */
+    std::condition_variable m_asyncSpace;
+    std::deque<AsyncBatch*> m_asyncQueue;
+    std::vector<AsyncBatch*> m_asyncFree;
+    bool             m_asyncStop;
 
 };
 
@@ -0,0 +1,333 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "sst/core/statapi/statoutputbinary.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include "sst/core/baseComponent.h"
+#include "sst/core/simulation.h"
+#include "sst/core/stringize.h"
+#include "sst/core/statapi/statbinaryformat.h"
+
+namespace SST {
+namespace Statistics {
+
+using namespace BinaryFormat;
+
+static uint32_t getBinaryFieldType(StatisticOutput::fieldType_t type)
+{
+    if ( type == StatisticFieldType<int32_t>::id() )  return INT32;
+    if ( type == StatisticFieldType<uint32_t>::id() ) return UINT32;
+    if ( type == StatisticFieldType<int64_t>::id() )  return INT64;
+    if ( type == StatisticFieldType<uint64_t>::id() ) return UINT64;
+    if ( type == StatisticFieldType<float>::id() )    return FLOAT;
+    if ( type == StatisticFieldType<double>::id() )   return DOUBLE;
+    Simulation::getSimulationOutput().fatal(CALL_INFO, 1,
+        " : StatisticOutputBinary - Unhandled field type %s\n",
+        StatisticFieldInfo::getFieldTypeFullName(type));
+    return 0;
+}
+
+
+StatisticOutputBinary::StatisticOutputBinary(Params& outputParameters)
+    : StatisticOutput (outputParameters),
+    m_hFile(nullptr),
+    m_blockRows(4096),
+    m_headerWritten(false),
+    m_currentTable(nullptr)
+{
+    // Announce this output object's name
+    Output &out = Simulation::getSimulationOutput();
+    out.verbose(CALL_INFO, 1, 0, " : StatisticOutputBinary enabled...\n");
+    setStatisticOutputName("StatisticOutputBinary");
+}
+
+bool StatisticOutputBinary::checkOutputParameters()
+{
+    bool foundKey;
+
+    // Review the output parameters and make sure they are correct, and
+    // also setup internal variables
+
+    // Look for Help Param
+    getOutputParameters().find<std::string>("help", "1", foundKey);
+    if (true == foundKey) {
+        return false;
+    }
+
+    // Get the parameters
+    m_FilePath = getOutputParameters().find<std::string>("filepath", "./StatisticOutput.bin");
+    m_blockRows = getOutputParameters().find<uint32_t>("blockrows", 4096);
+
+    // Perform some checking on the parameters
+    if (0 == m_FilePath.length()) {
+        // Filepath is zero length
+        return false;
+    }
+    if (0 == m_blockRows) {
+        return false;
+    }
+
+    return true;
+}
+
+void StatisticOutputBinary::printUsage()
+{
+    // Display how to use this output object
+    Output out("", 0, 0, Output::STDOUT);
+    out.output(" : Usage - Sends all statistic output to a columnar binary file.\n");
+    out.output(" : Parameters:\n");
+    out.output(" : help = Force Statistic Output to display usage\n");
+    out.output(" : filepath = <Path to .bin file> - Default is ./StatisticOutput.bin\n");
+    out.output(" : blockrows = <Number of entries> - Most entries written in one block - Default is 4096\n");
+    out.output(" : async = 0 | 1 - Write the output on a separate thread - Default is 0\n");
+    out.output(" : With more than one rank, each rank writes its own file with _<rank> added to the name,\n");
+    out.output(" : and rank 0 writes <filepath>.index, which sst-stat-merge uses to combine them\n");
+}
+
+
+void StatisticOutputBinary::implStartRegisterFields(StatisticBase *stat)
+{
+    if ( m_headerWritten ) {
+        Simulation::getSimulationOutput().fatal(CALL_INFO, 1,
+            " : StatisticOutputBinary - Statistic %s registered after the simulation started\n",
+            stat->getFullStatName().c_str());
+    }
+    m_statMap[stat] = m_stats.size();
+    m_stats.push_back({stat, 0});
+    m_registerFields.clear();
+}
+
+void StatisticOutputBinary::implRegisteredField(fieldHandle_t fieldHandle)
+{
+    m_registerFields.push_back(fieldHandle);
+}
+
+void StatisticOutputBinary::implStopRegisterFields()
+{
+    // Statistics that output the same fields share a table
+    auto iter = m_tableMap.find(m_registerFields);
+    uint32_t tableIndex;
+    if ( iter == m_tableMap.end() ) {
+        tableIndex = m_tables.size();
+        m_tableMap[m_registerFields] = tableIndex;
+
+        m_tables.emplace_back();
+        Table& table = m_tables.back();
+        table.fields = m_registerFields;
+        table.time = 0;
+        for ( size_t i = 0; i < table.fields.size(); i++ ) {
+            StatisticFieldInfo* fi = getRegisteredField(table.fields[i]);
+            table.columnIndex[table.fields[i]] = i;
+            table.widths.push_back(fieldWidth(getBinaryFieldType(fi->getFieldType())));
+        }
+        table.columns.resize(table.fields.size());
+    } else {
+        tableIndex = iter->second;
+    }
+    m_stats.back().table = tableIndex;
+}
+
+
+void StatisticOutputBinary::startOfSimulation()
+{
+    // Let sst-stat-merge find the files of all ranks
+    writeRankIndex(m_FilePath, "binary");
+
+    // Set Filename with Rank if Num Ranks > 1
+    m_FilePath = getRankFilePath(m_FilePath);
+
+    m_hFile = fopen(m_FilePath.c_str(), "wb");
+    if (nullptr == m_hFile) {
+        Simulation::getSimulationOutput().fatal(CALL_INFO, 1,
+            " : StatisticOutputBinary - Problem opening File %s - %s\n", m_FilePath.c_str(), strerror(errno));
+    }
+
+    writeHeader();
+    m_headerWritten = true;
+}
+
+void StatisticOutputBinary::endOfSimulation()
+{
+    if (nullptr == m_hFile) return;
+
+    for ( uint32_t i = 0; i < m_tables.size(); i++ ) {
+        if ( !m_tables[i].stats.empty() ) writeBlock(i);
+    }
+    fclose(m_hFile);
+    m_hFile = nullptr;
+}
+
+
+void StatisticOutputBinary::implStartOutputEntries(StatisticBase* statistic)
+{
+    uint32_t statIndex = m_statMap.at(statistic);
+    uint32_t tableIndex = m_stats[statIndex].table;
+    Table& table = m_tables[tableIndex];
+
+    // Each block only holds entries from one simulation time
+    SimTime_t time = getEntrySimTime();
+    if ( !table.stats.empty() && (table.time != time || table.stats.size() >= m_blockRows) ) {
+        writeBlock(tableIndex);
+    }
+    table.time = time;
+
+    // Fields that are not output are left at zero
+    table.stats.push_back(statIndex);
+    for ( size_t i = 0; i < table.columns.size(); i++ ) {
+        table.columns[i].resize(table.columns[i].size() + table.widths[i], 0);
+    }
+    m_currentTable = &table;
+}
+
+void StatisticOutputBinary::implStopOutputEntries()
+{
+    m_currentTable = nullptr;
+}
+
+
+template<typename T>
+void StatisticOutputBinary::setField(fieldHandle_t fieldHandle, T data)
+{
+    auto iter = m_currentTable->columnIndex.find(fieldHandle);
+    if ( iter == m_currentTable->columnIndex.end() ) {
+        Simulation::getSimulationOutput().fatal(CALL_INFO, 1, "Attempting to access unregistered Field Handle\n");
+    }
+    std::vector<char>& column = m_currentTable->columns[iter->second];
+    memcpy(&column[column.size() - sizeof(T)], &data, sizeof(T));
+}
+
+void StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, int32_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, uint32_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, int64_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, uint64_t data)
+{
+    setField(fieldHandle, data);
+}
+
+void StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, float data)
+{
+    setField(fieldHandle, data);
+}
+
+void StatisticOutputBinary::outputField(fieldHandle_t fieldHandle, double data)
+{
+    setField(fieldHandle, data);
+}
+
+
+void StatisticOutputBinary::writeString(const std::string& str)
+{
+    uint32_t len = str.length();
+    fwrite(&len, sizeof(len), 1, m_hFile);
+    fwrite(str.data(), 1, len, m_hFile);
+}
+
+void StatisticOutputBinary::writePadding(size_t bytes)
+{
+    static const char zeros[8] = { 0 };
+    fwrite(zeros, 1, padTo8(bytes) - bytes, m_hFile);
+}
+
+void StatisticOutputBinary::writeHeader()
+{
+    FileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.rank = Simulation::getSimulation()->getRank().rank;
+    header.numFields = getFieldInfoArray().size();
+    header.numTables = m_tables.size();
+    header.numStats = m_stats.size();
+    fwrite(&header, sizeof(header), 1, m_hFile);
+
+    // Field handles are indexes into the field info array
+    for ( StatisticFieldInfo* fi : getFieldInfoArray() ) {
+        uint32_t type = getBinaryFieldType(fi->getFieldType());
+        fwrite(&type, sizeof(type), 1, m_hFile);
+        writeString(fi->getStatName());
+        writeString(fi->getFieldName());
+        writePadding(3 * sizeof(uint32_t) + fi->getStatName().length() + fi->getFieldName().length());
+    }
+
+    for ( Table& table : m_tables ) {
+        uint32_t numColumns = table.fields.size();
+        fwrite(&numColumns, sizeof(numColumns), 1, m_hFile);
+        for ( fieldHandle_t field : table.fields ) {
+            uint32_t index = field;
+            fwrite(&index, sizeof(index), 1, m_hFile);
+        }
+        writePadding((numColumns + 1) * sizeof(uint32_t));
+    }
+
+    for ( StatInfo& info : m_stats ) {
+        StatisticBase* stat = info.statistic;
+        uint64_t compId = stat->getComponent()->getId();
+        fwrite(&info.table, sizeof(info.table), 1, m_hFile);
+        fwrite(&header.rank, sizeof(header.rank), 1, m_hFile);
+        fwrite(&compId, sizeof(compId), 1, m_hFile);
+        writeString(stat->getCompName());
+        writeString(stat->getStatName());
+        writeString(stat->getStatSubId());
+        writeString(stat->getStatTypeName());
+        writePadding(6 * sizeof(uint32_t) + sizeof(compId) + stat->getCompName().length() + stat->getStatName().length() +
+                     stat->getStatSubId().length() + stat->getStatTypeName().length());
+    }
+
+    // Now that the registries are written, fill in where the blocks start
+    header.dataOffset = ftell(m_hFile);
+    fseek(m_hFile, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, m_hFile);
+    fseek(m_hFile, header.dataOffset, SEEK_SET);
+}
+
+void StatisticOutputBinary::writeBlock(uint32_t tableIndex)
+{
+    Table& table = m_tables[tableIndex];
+
+    BlockHeader header;
+    header.numRows = table.stats.size();
+    header.simTime = table.time;
+    header.table = tableIndex;
+    header.size = sizeof(header) + padTo8(header.numRows * sizeof(uint32_t));
+    for ( auto& column : table.columns ) {
+        header.size += padTo8(column.size());
+    }
+
+    fwrite(&header, sizeof(header), 1, m_hFile);
+    fwrite(table.stats.data(), sizeof(uint32_t), header.numRows, m_hFile);
+    writePadding(header.numRows * sizeof(uint32_t));
+    for ( auto& column : table.columns ) {
+        fwrite(column.data(), 1, column.size(), m_hFile);
+        writePadding(column.size());
+        column.clear();
+    }
+    table.stats.clear();
+}
+
+} //namespace Statistics
+} //namespace SST
@@ -0,0 +1,149 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_CORE_STATISTICS_OUTPUTBINARY
+#define _H_SST_CORE_STATISTICS_OUTPUTBINARY
+
+#include "sst/core/sst_types.h"
+
+#include "sst/core/statapi/statoutput.h"
+
+#include <map>
+#include <unordered_map>
+
+namespace SST {
+namespace Statistics {
+
+/**
+    \class StatisticOutputBinary
+
+    The class for statistics output to a columnar binary file.  The
+    file starts with a registry of the fields and statistics, followed
+    by blocks holding one fixed width column per field.  The layout is
+    described in statbinaryformat.h, and StatisticBinaryReader reads it.
+*/
+class StatisticOutputBinary : public StatisticOutput
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+      StatisticOutput,
+      StatisticOutputBinary,
+      "sst",
+      "statoutputbinary",
+      SST_ELI_ELEMENT_VERSION(1,0,0),
+      "Output to a columnar binary file")
+
+    /** Construct a StatOutputBinary
+     * @param outputParameters - Parameters used for this Statistic Output
+     */
+    StatisticOutputBinary(Params& outputParameters);
+
+protected:
+    /** Perform a check of provided parameters
+     * @return True if all required parameters and options are acceptable
+     */
+    bool checkOutputParameters() override;
+
+    /** Print out usage for this Statistic Output */
+    void printUsage() override;
+
+    void implStartRegisterFields(StatisticBase *stat) override;
+    void implRegisteredField(fieldHandle_t fieldHandle) override;
+    void implStopRegisterFields() override;
+
+    /** Indicate to Statistic Output that simulation started.
+     *  Statistic output may perform any startup code here as necessary.
+     */
+    void startOfSimulation() override;
+
+    /** Indicate to Statistic Output that simulation ended.
+     *  Statistic output may perform any shutdown code here as necessary.
+     */
+    void endOfSimulation() override;
+
+    /** Implementation function for the start of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is about to send data to the Statistic Output for processing.
+     * @param statistic - Pointer to the statistic object than the output can
+     * retrieve data from.
+     */
+    void implStartOutputEntries(StatisticBase* statistic) override;
+
+    /** Implementation function for the end of output.
+     * This will be called by the Statistic Processing Engine to indicate that
+     * a Statistic is finished sending data to the Statistic Output for processing.
+     * The Statistic Output can perform any output related functions here.
+     */
+    void implStopOutputEntries() override;
+
+    /** Implementation functions for output.
+     * These will be called by the statistic to provide Statistic defined
+     * data to be output.
+     * @param fieldHandle - The handle to the registered statistic field.
+     * @param data - The data related to the registered field to be output.
+     */
+    void outputField(fieldHandle_t fieldHandle, int32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint32_t data) override;
+    void outputField(fieldHandle_t fieldHandle, int64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, uint64_t data) override;
+    void outputField(fieldHandle_t fieldHandle, float data) override;
+    void outputField(fieldHandle_t fieldHandle, double data) override;
+
+protected:
+    StatisticOutputBinary() {;} // For serialization
+
+private:
+    /* Entries of one set of fields, buffered until the block is written */
+    struct Table {
+        std::vector<fieldHandle_t> fields;
+        std::map<fieldHandle_t, size_t> columnIndex;
+        std::vector<size_t> widths;
+
+        SimTime_t time;
+        std::vector<uint32_t> stats;
+        std::vector<std::vector<char>> columns;
+    };
+
+    struct StatInfo {
+        StatisticBase* statistic;
+        uint32_t table;
+    };
+
+    template<typename T>
+    void setField(fieldHandle_t fieldHandle, T data);
+
+    void writeHeader();
+    void writeBlock(uint32_t tableIndex);
+    void writeString(const std::string& str);
+    void writePadding(size_t bytes);
+
+private:
+    FILE*                    m_hFile;
+    std::string              m_FilePath;
+    uint32_t                 m_blockRows;
+    bool                     m_headerWritten;
+
+    std::vector<Table>       m_tables;
+    std::map<std::vector<fieldHandle_t>, uint32_t> m_tableMap;
+    std::vector<StatInfo>    m_stats;
+    std::unordered_map<StatisticBase*, uint32_t> m_statMap;
+
+    /* Registration in progress */
+    std::vector<fieldHandle_t> m_registerFields;
+
+    /* Entry in progress */
+    Table*                   m_currentTable;
+};
+
+} //namespace Statistics
+} //namespace SST
+
+#endif
@@ -79,6 +79,9 @@ void StatisticOutputCSV::printUsage()
     out.output(" : outputtopheader = 0 | 1 - Output Header at top - Default is 1\n");
     out.output(" : outputsimtime = 0 | 1 - Output Simulation Time - Default is 1\n");
     out.output(" : outputrank = 0 | 1 - Output Rank - Default is 1\n");
+    out.output(" : async = 0 | 1 - Format and write the output on a separate thread - Default is 0\n");
+    out.output(" : With more than one rank, each rank writes its own file with _<rank> added to the name,\n");
+    out.output(" : and rank 0 writes <filepath>.index, which sst-stat-merge uses to combine them\n");
 }
 
 void StatisticOutputCSV::startOfSimulation() 
@@ -87,21 +90,17 @@ void StatisticOutputCSV::startOfSimulation()
     std::string                outputBuffer;
     FieldInfoArray_t::iterator it_v;
     
+    // Let sst-stat-merge find the files of all ranks
+    std::map<std::string, std::string> indexOptions;
+    indexOptions["separator"] = m_Separator;
+    indexOptions["header"] = m_outputTopHeader ? "1" : "0";
+    indexOptions["simtime"] = m_outputSimTime ? "1" : "0";
+    indexOptions["outputrank"] = m_outputRank ? "1" : "0";
+    indexOptions["compressed"] = m_useCompression ? "1" : "0";
+    writeRankIndex(m_FilePath, "csv", indexOptions);
+
     // Set Filename with Rank if Num Ranks > 1
-    if (1 < Simulation::getSimulation()->getNumRanks().rank) {
-        int rank = Simulation::getSimulation()->getRank().rank;
-        std::string rankstr = "_" + SST::to_string(rank);
-
-        // Search for any extension        
-        size_t index = m_FilePath.find_last_of(".");
-        if (std::string::npos != index) {
-            // We found a . at the end of the file, insert the rank string
-            m_FilePath.insert(index, rankstr);
-        } else {
-            // No . found, append the rank string
-            m_FilePath += rankstr;
-        }
-    }
+    m_FilePath = getRankFilePath(m_FilePath);
 
     // Open the finalized filename
     if ( !openFile() )
@@ -204,14 +203,14 @@ void StatisticOutputCSV::implStopOutputEntries()
     // Done with Output, Send a line of data to the file
     if (true == m_outputSimTime) {
         // Add the Simulation Time to the front
-        print("%" PRIu64, Simulation::getSimulation()->getCurrentSimCycle());
+        print("%" PRIu64, getEntrySimTime());
         print("%s", m_Separator.c_str());
     }
 
     // Done with Output, Send a line of data to the file
     if (true == m_outputRank) {
         // Add the Simulation Time to the front
-        print("%d", Simulation::getSimulation()->getRank().rank);
+        print("%d", getEntryRank());
         print("%s", m_Separator.c_str());
     }
     
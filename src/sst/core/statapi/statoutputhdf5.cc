@@ -26,6 +26,8 @@ namespace Statistics {
 StatisticOutputHDF5::StatisticOutputHDF5(Params& outputParameters)
     : StatisticOutput (outputParameters),
     m_hFile(nullptr),
+    m_chunkSize(1024),
+    m_deflate(7),
     m_currentDataSet(nullptr)
 {
     // Announce this output object's name
@@ -55,6 +57,18 @@ bool StatisticOutputHDF5::checkOutputParameters()
         return false;
     }
 
+    // Entries are buffered and written this many at a time, which is
+    // also the chunk size of the datasets
+    m_chunkSize = getOutputParameters().find<uint32_t>("chunksize", 1024);
+    if (0 == m_chunkSize) {
+        return false;
+    }
+
+    m_deflate = getOutputParameters().find<int>("compression", 7);
+    if (m_deflate < 0 || m_deflate > 9) {
+        return false;
+    }
+
     H5::Exception::dontPrint();
 
     m_hFile = new H5::H5File(m_filePath, H5F_ACC_TRUNC);
@@ -70,6 +84,8 @@ void StatisticOutputHDF5::printUsage()
     out.output(" : Parameters:\n");
     out.output(" : help = Force Statistic Output to display usage\n");
     out.output(" : filepath = <Path to .h5 file> - Default is ./StatisticOutput.h5\n");
+    out.output(" : chunksize = <Number of entries> - Entries buffered per statistic before writing, and the HDF5 chunk size - Default is 1024\n");
+    out.output(" : compression = <0-9> - Deflate level, 0 disables compression - Default is 7\n");
 }
 
 
@@ -101,7 +117,7 @@ void StatisticOutputHDF5::implStartRegisterGroup(StatisticGroup* group )
 {
     m_statGroups.emplace(std::piecewise_construct,
             std::forward_as_tuple(group->name),
-            std::forward_as_tuple(group, m_hFile));
+            std::forward_as_tuple(group, m_hFile, m_chunkSize, m_deflate));
     m_currentDataSet = &m_statGroups.at(group->name);
     m_currentDataSet->beginGroupRegistration(group);
 }
@@ -122,8 +138,12 @@ void StatisticOutputHDF5::startOfSimulation()
 void StatisticOutputHDF5::endOfSimulation()
 {
     for ( auto i : m_statistics ) {
+        i.second->flush();
         delete i.second;
     }
+    for ( auto &i : m_statGroups ) {
+        i.second.flush();
+    }
     delete m_hFile;
 }
 
@@ -134,7 +154,7 @@ void StatisticOutputHDF5::implStartOutputEntries(StatisticBase* statistic)
 {
     if ( m_currentDataSet == nullptr )
         m_currentDataSet = getStatisticInfo(statistic);
-    m_currentDataSet->startNewEntry(statistic);
+    m_currentDataSet->startNewEntry(getEntrySimTime(), statistic);
 }
 
 void StatisticOutputHDF5::implStopOutputEntries()
@@ -149,7 +169,7 @@ void StatisticOutputHDF5::implStopOutputEntries()
 void StatisticOutputHDF5::implStartOutputGroup(StatisticGroup* group)
 {
     m_currentDataSet = &m_statGroups.at(group->name);
-    m_currentDataSet->startNewGroupEntry();
+    m_currentDataSet->startNewGroupEntry(getEntrySimTime());
 }
 
 
@@ -197,7 +217,7 @@ void StatisticOutputHDF5::outputField(fieldHandle_t fieldHandle, double data)
 
 StatisticOutputHDF5::StatisticInfo* StatisticOutputHDF5::initStatistic(StatisticBase* statistic)
 {
-    StatisticInfo *si = new StatisticInfo(statistic, m_hFile);
+    StatisticInfo *si = new StatisticInfo(statistic, m_hFile, m_chunkSize, m_deflate);
     m_statistics[statistic] = si;
     return si;
 }
@@ -212,12 +232,12 @@ StatisticOutputHDF5::StatisticInfo* StatisticOutputHDF5::getStatisticInfo(Statis
 
 
 
-void StatisticOutputHDF5::StatisticInfo::startNewEntry(StatisticBase *UNUSED(stat))
+void StatisticOutputHDF5::StatisticInfo::startNewEntry(SimTime_t simTime, StatisticBase *UNUSED(stat))
 {
     for ( StatData_u &i : currentData ) {
         memset(&i, '\0', sizeof(i));
     }
-    currentData[0].u64 = Simulation::getSimulation()->getCurrentSimCycle();
+    currentData[0].u64 = simTime;
 }
 
 
@@ -236,17 +256,30 @@ StatisticOutputHDF5::StatData_u& StatisticOutputHDF5::StatisticInfo::getFieldLoc
 
 void StatisticOutputHDF5::StatisticInfo::finishEntry()
 {
-    hsize_t dims[1] = {1};
+    buffer.insert(buffer.end(), currentData.begin(), currentData.end());
+    if ( ++nBuffered >= chunkSize )
+        flush();
+}
+
+
+void StatisticOutputHDF5::StatisticInfo::flush()
+{
+    if ( nBuffered == 0 ) return;
+
+    hsize_t dims[1] = { nBuffered };
     hsize_t offset[1] = { nEntries };
 
-    hsize_t newSize[1] = { ++nEntries };
+    nEntries += nBuffered;
+    hsize_t newSize[1] = { nEntries };
     dataset->extend(newSize);
 
     H5::DataSpace fspace = dataset->getSpace();
     H5::DataSpace memSpace( 1, dims );
     fspace.selectHyperslab( H5S_SELECT_SET, dims, offset );
-    dataset->write(currentData.data(), *memType, memSpace, fspace);
+    dataset->write(buffer.data(), *memType, memSpace, fspace);
 
+    buffer.clear();
+    nBuffered = 0;
 }
 
 
@@ -285,6 +318,7 @@ void StatisticOutputHDF5::StatisticInfo::finalizeCurrentStatistic()
 {
     size_t nFields = typeList.size();
     currentData.resize(nFields);
+    buffer.reserve(nFields * chunkSize);
 
     /* Build HDF5 datatypes */
     size_t dataSize = currentData.size() * sizeof(StatData_u);
@@ -327,9 +361,9 @@ void StatisticOutputHDF5::StatisticInfo::finalizeCurrentStatistic()
     hsize_t maxdims[1] = { H5S_UNLIMITED };
     H5::DataSpace dspace(1, dims, maxdims);
     H5::DSetCreatPropList cparms;
-    hsize_t chunk_dims[1] = {1024};
+    hsize_t chunk_dims[1] = { chunkSize };
     cparms.setChunk(1, chunk_dims);
-    cparms.setDeflate(7);
+    setCompression(cparms);
 
     dataset = new H5::DataSet( file->createDataSet(statName, *memType, dspace, cparms) );
 
@@ -341,8 +375,8 @@ void StatisticOutputHDF5::StatisticInfo::finalizeCurrentStatistic()
 
 
 
-StatisticOutputHDF5::GroupInfo::GroupInfo(StatisticGroup *group, H5::H5File *file) :
-    DataSet(file), nEntries(0), m_statGroup(group)
+StatisticOutputHDF5::GroupInfo::GroupInfo(StatisticGroup *group, H5::H5File *file, hsize_t chunkSize, int deflate) :
+    DataSet(file, chunkSize, deflate), nEntries(0), m_statGroup(group), timeDataSet(nullptr)
 {
     /* We need to store component pointers, not just IDs */
     m_components.resize(m_statGroup->components.size());
@@ -442,7 +476,7 @@ void StatisticOutputHDF5::GroupInfo::finalizeGroupRegistration()
     H5::DSetCreatPropList cparms;
     hsize_t chunk_dims[1] = {std::min(m_statGroup->components.size(), (size_t)64)};
     cparms.setChunk(1, chunk_dims);
-    cparms.setDeflate(7);
+    setCompression(cparms);
 
 
 
@@ -488,7 +522,12 @@ void StatisticOutputHDF5::GroupInfo::finalizeGroupRegistration()
     hsize_t tdim[1] = {0};
     hsize_t maxdims[1] = { H5S_UNLIMITED };
     H5::DataSpace tspace(1, tdim, maxdims);
-    timeDataSet = new H5::DataSet(getFile()->createDataSet("/" + getName() + "/timestamps", H5::PredType::NATIVE_UINT64, tspace, cparms));
+    H5::DSetCreatPropList tparms;
+    hsize_t tchunk_dims[1] = { chunkSize };
+    tparms.setChunk(1, tchunk_dims);
+    setCompression(tparms);
+    timeDataSet = new H5::DataSet(getFile()->createDataSet("/" + getName() + "/timestamps", H5::PredType::NATIVE_UINT64, tspace, tparms));
+    timeBuffer.reserve(chunkSize);
 
 }
 
@@ -499,28 +538,18 @@ void StatisticOutputHDF5::GroupInfo::finalizeGroupRegistration()
 
 
 
-void StatisticOutputHDF5::GroupInfo::startNewGroupEntry() {
+void StatisticOutputHDF5::GroupInfo::startNewGroupEntry(SimTime_t simTime) {
     /* Record current timestamp */
     for ( auto & gs : m_statGroups ) {
         gs.second.startNewGroupEntry();
     }
 
-    hsize_t dims[1] = {1};
-    hsize_t offset[1] = { nEntries };
-
-    hsize_t newSize[1] = { ++nEntries };
-    timeDataSet->extend(newSize);
-
-    H5::DataSpace fspace = timeDataSet->getSpace();
-    H5::DataSpace memSpace( 1, dims );
-    fspace.selectHyperslab( H5S_SELECT_SET, dims, offset );
-    uint64_t currTime = Simulation::getSimulation()->getCurrentSimCycle();
-    timeDataSet->write(&currTime, H5::PredType::NATIVE_UINT64, memSpace, fspace);
+    timeBuffer.push_back(simTime);
 }
 
 
 
-void StatisticOutputHDF5::GroupInfo::startNewEntry(StatisticBase *stat)
+void StatisticOutputHDF5::GroupInfo::startNewEntry(SimTime_t UNUSED(simTime), StatisticBase *stat)
 {
     m_currentStat = &(m_statGroups.at(GroupStat::getStatName(stat)));
     size_t compIndex = std::distance(m_components.begin(),
@@ -540,6 +569,32 @@ void StatisticOutputHDF5::GroupInfo::finishGroupEntry()
     for ( auto & gs : m_statGroups ) {
         gs.second.finishGroupEntry();
     }
+    if ( timeBuffer.size() >= chunkSize )
+        flush();
+}
+
+
+void StatisticOutputHDF5::GroupInfo::flush()
+{
+    for ( auto & gs : m_statGroups ) {
+        gs.second.flush();
+    }
+
+    if ( timeBuffer.empty() ) return;
+
+    hsize_t dims[1] = { timeBuffer.size() };
+    hsize_t offset[1] = { nEntries };
+
+    nEntries += timeBuffer.size();
+    hsize_t newSize[1] = { nEntries };
+    timeDataSet->extend(newSize);
+
+    H5::DataSpace fspace = timeDataSet->getSpace();
+    H5::DataSpace memSpace( 1, dims );
+    fspace.selectHyperslab( H5S_SELECT_SET, dims, offset );
+    timeDataSet->write(timeBuffer.data(), H5::PredType::NATIVE_UINT64, memSpace, fspace);
+
+    timeBuffer.clear();
 }
 
 const std::string& StatisticOutputHDF5::GroupInfo::getName() const
@@ -557,7 +612,7 @@ std::string StatisticOutputHDF5::GroupInfo::GroupStat::getStatName(StatisticBase
 }
 
 StatisticOutputHDF5::GroupInfo::GroupStat::GroupStat(GroupInfo* group, StatisticBase* stat) :
-    gi(group), nEntries(0)
+    gi(group), dataset(nullptr), memType(nullptr), nEntries(0), nBuffered(0)
 {
 
     /* Create the file hierarchy */
@@ -579,6 +634,7 @@ void StatisticOutputHDF5::GroupInfo::GroupStat::finalizeRegistration()
 {
     size_t nslots = registeredFields.size();
     currentData.resize(nslots * gi->getNumComponents());
+    buffer.resize(currentData.size() * gi->getChunkSize());
 
     /* Build a HDF5 in-Memory datatype */
     size_t dataSize = nslots * sizeof(StatData_u);
@@ -594,9 +650,9 @@ void StatisticOutputHDF5::GroupInfo::GroupStat::finalizeRegistration()
 
     H5::DataSpace dspace(2, dims, maxdims);
     H5::DSetCreatPropList cparms;
-    hsize_t chunk_dims[2] = {std::min((hsize_t)16, dims[0]), 128};
+    hsize_t chunk_dims[2] = {std::min((hsize_t)16, dims[0]), gi->getChunkSize()};
     cparms.setChunk(2, chunk_dims);
-    cparms.setDeflate(7);
+    gi->setCompression(cparms);
 
     dataset = new H5::DataSet( gi->getFile()->createDataSet(statPath, *memType, dspace, cparms) );
 }
@@ -631,17 +687,41 @@ void StatisticOutputHDF5::GroupInfo::GroupStat::finishEntry()
 
 void StatisticOutputHDF5::GroupInfo::GroupStat::finishGroupEntry()
 {
-    /* TODO */
-    hsize_t dims[2] = {gi->getNumComponents(), 1};
+    /* Copy each component's row into its column of the buffer */
+    size_t nslots = registeredFields.size();
+    size_t rowLen = nslots * gi->getChunkSize();
+    for ( size_t c = 0 ; c < gi->getNumComponents() ; c++ ) {
+        std::copy(currentData.begin() + c * nslots,
+                currentData.begin() + (c + 1) * nslots,
+                buffer.begin() + c * rowLen + nBuffered * nslots);
+    }
+    /* The group flushes once its timestamps fill a chunk */
+    nBuffered++;
+}
+
+
+void StatisticOutputHDF5::GroupInfo::GroupStat::flush()
+{
+    if ( nBuffered == 0 ) return;
+
+    hsize_t dims[2] = {gi->getNumComponents(), nBuffered};
     hsize_t offset[2] = { 0, nEntries };
 
-    hsize_t newSize[2] = { gi->getNumComponents(), ++nEntries };
+    nEntries += nBuffered;
+    hsize_t newSize[2] = { gi->getNumComponents(), nEntries };
     dataset->extend(newSize);
 
     H5::DataSpace fspace = dataset->getSpace();
-    H5::DataSpace memSpace( 2, dims );
     fspace.selectHyperslab( H5S_SELECT_SET, dims, offset );
-    dataset->write(currentData.data(), *memType, memSpace, fspace);
+
+    /* The buffer always holds a full chunk of entries per component */
+    hsize_t memDims[2] = {gi->getNumComponents(), gi->getChunkSize()};
+    hsize_t memOffset[2] = { 0, 0 };
+    H5::DataSpace memSpace( 2, memDims );
+    memSpace.selectHyperslab( H5S_SELECT_SET, dims, memOffset );
+    dataset->write(buffer.data(), *memType, memSpace, fspace);
+
+    nBuffered = 0;
 }
 
 
@@ -123,9 +123,15 @@ private:
 
     class DataSet {
     public:
-        DataSet(H5::H5File *file) : file(file) { }
+        DataSet(H5::H5File *file, hsize_t chunkSize, int deflate) :
+            file(file), chunkSize(chunkSize), deflate(deflate) { }
         virtual ~DataSet() { }
         H5::H5File* getFile() { return file; }
+        hsize_t getChunkSize() const { return chunkSize; }
+        /** Turn on compression, if enabled, for a new dataset */
+        void setCompression(H5::DSetCreatPropList &cparms) const {
+            if ( deflate > 0 ) cparms.setDeflate(deflate);
+        }
         virtual bool isGroup() const = 0;
 
         virtual void setCurrentStatistic(StatisticBase *UNUSED(stat)) { }
@@ -136,15 +142,20 @@ private:
         virtual void finalizeGroupRegistration() { }
 
 
-        virtual void startNewGroupEntry() {}
+        virtual void startNewGroupEntry(SimTime_t UNUSED(simTime)) {}
         virtual void finishGroupEntry() {}
 
-        virtual void startNewEntry(StatisticBase *stat) = 0;
+        virtual void startNewEntry(SimTime_t simTime, StatisticBase *stat) = 0;
         virtual StatData_u& getFieldLoc(fieldHandle_t fieldHandle) = 0;
         virtual void finishEntry() = 0;
 
+        /** Write out any buffered entries */
+        virtual void flush() = 0;
+
     protected:
         H5::H5File *file;
+        hsize_t chunkSize;
+        int deflate;
     };
 
     class StatisticInfo : public DataSet {
@@ -159,9 +170,14 @@ private:
 
         hsize_t nEntries;
 
+        /* Entries not yet written, stored back to back */
+        std::vector<StatData_u> buffer;
+        hsize_t nBuffered;
+
     public:
-        StatisticInfo(StatisticBase *stat, H5::H5File *file) :
-            DataSet(file), statistic(stat), nEntries(0)
+        StatisticInfo(StatisticBase *stat, H5::H5File *file, hsize_t chunkSize, int deflate) :
+            DataSet(file, chunkSize, deflate), statistic(stat),
+            dataset(nullptr), memType(nullptr), nEntries(0), nBuffered(0)
         {
             typeList.push_back(StatisticFieldType<uint64_t>::id());
             indexMap.push_back(-1);
@@ -175,9 +191,10 @@ private:
         void finalizeCurrentStatistic() override;
 
         bool isGroup() const override { return false; }
-        void startNewEntry(StatisticBase *stat) override;
+        void startNewEntry(SimTime_t simTime, StatisticBase *stat) override;
         StatData_u& getFieldLoc(fieldHandle_t fieldHandle) override;
         void finishEntry() override;
+        void flush() override;
     };
 
     class GroupInfo : public DataSet {
@@ -197,6 +214,11 @@ private:
             std::vector<StatData_u> currentData;
             size_t currentCompOffset;
 
+            /* Buffered entries, laid out as [component][entry][field]
+             * to match the file's {components, entries} layout */
+            std::vector<StatData_u> buffer;
+            hsize_t nBuffered;
+
 
             GroupStat(GroupInfo *group, StatisticBase *stat);
             void finalizeRegistration();
@@ -209,6 +231,7 @@ private:
             void finishEntry();
 
             void finishGroupEntry();
+            void flush();
         };
 
 
@@ -219,9 +242,10 @@ private:
         StatisticGroup *m_statGroup;
         std::vector<BaseComponent*> m_components;
         H5::DataSet *timeDataSet;
+        std::vector<uint64_t> timeBuffer;
 
     public:
-        GroupInfo(StatisticGroup *group, H5::H5File *file);
+        GroupInfo(StatisticGroup *group, H5::H5File *file, hsize_t chunkSize, int deflate);
         void beginGroupRegistration(StatisticGroup *UNUSED(group)) override { }
         void setCurrentStatistic(StatisticBase *stat) override;
         void registerField(StatisticFieldInfo *fi) override;
@@ -229,12 +253,13 @@ private:
         void finalizeGroupRegistration() override;
 
         bool isGroup() const override { return true; }
-        void startNewEntry(StatisticBase *stat) override;
+        void startNewEntry(SimTime_t simTime, StatisticBase *stat) override;
         StatData_u& getFieldLoc(fieldHandle_t fieldHandle) override { return m_currentStat->getFieldLoc(fieldHandle); }
         void finishEntry() override;
 
-        void startNewGroupEntry() override;
+        void startNewGroupEntry(SimTime_t simTime) override;
         void finishGroupEntry() override;
+        void flush() override;
         size_t getNumComponents() const { return m_components.size(); }
 
         const std::string& getName() const;
@@ -242,6 +267,8 @@ private:
 
 
     H5::H5File*              m_hFile;
+    hsize_t                  m_chunkSize;
+    int                      m_deflate;
     DataSet*                 m_currentDataSet;
     std::map<StatisticBase*, StatisticInfo*> m_statistics;
     std::map<std::string, GroupInfo> m_statGroups;
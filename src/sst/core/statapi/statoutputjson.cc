@@ -13,6 +13,7 @@
 
 #include "sst/core/statapi/statoutputjson.h"
 
+#include "sst/core/baseComponent.h"
 #include "sst/core/simulation.h"
 #include "sst/core/statapi/statoutputcsv.h"
 #include "sst/core/stringize.h"
@@ -31,6 +32,7 @@ StatisticOutputJSON::StatisticOutputJSON(Params& outputParameters)
     m_currentComponentName = "";
     m_firstEntry = false;
     m_processedAnyStats = false;
+    m_curIndentLevel = 0;
 }
 
 bool StatisticOutputJSON::checkOutputParameters()
@@ -75,10 +77,19 @@ void StatisticOutputJSON::printUsage()
     out.output(" : filepath = <Path to .csv file> - Default is ./StatisticOutput.csv\n");
     out.output(" : outputsimtime = 0 | 1 - Output Simulation Time - Default is 1\n");
     out.output(" : outputrank = 0 | 1 - Output Rank - Default is 1\n");
+    out.output(" : async = 0 | 1 - Format and write the output on a separate thread - Default is 0\n");
+    out.output(" : With more than one rank, each rank writes its own file with _<rank> added to the name,\n");
+    out.output(" : and rank 0 writes <filepath>.index, which sst-stat-merge uses to combine them\n");
 }
 
 void StatisticOutputJSON::startOfSimulation() 
 {
+    // Let sst-stat-merge find the files of all ranks
+    writeRankIndex(m_FilePath, "json");
+
+    // Set Filename with Rank if Num Ranks > 1
+    m_FilePath = getRankFilePath(m_FilePath);
+
     // Open the finalized filename
     if ( ! openFile() )
         return;
@@ -90,7 +101,7 @@ void StatisticOutputJSON::startOfSimulation()
         const int thisRank = Simulation::getSimulation()->getRank().rank;
         
         printIndent();
-        fprintf(m_hFile, "\"rank\" : %d\n\n", thisRank);
+        fprintf(m_hFile, "\"rank\" : %d,\n", thisRank);
     }
 
     printIndent();
@@ -138,6 +149,8 @@ void StatisticOutputJSON::implStartOutputEntries(StatisticBase* statistic)
         m_curIndentLevel++;
         printIndent();
         fprintf(m_hFile, "\"name\" : \"%s\",\n", statistic->getCompName().c_str());
+        printIndent();
+        fprintf(m_hFile, "\"id\" : %" PRIu64 ",\n", statistic->getComponent()->getId());
 
         printIndent();
         fprintf(m_hFile, "\"statistics\" : [\n");
@@ -160,7 +173,11 @@ void StatisticOutputJSON::implStartOutputEntries(StatisticBase* statistic)
     }
     
     printIndent();
-    fprintf(m_hFile, "{ \"stat\" : \"%s\", \"values\" : [ ", statistic->getStatName().c_str());
+    fprintf(m_hFile, "{ \"stat\" : \"%s\", ", statistic->getStatName().c_str());
+    if (true == m_outputSimTime) {
+        fprintf(m_hFile, "\"time\" : %" PRIu64 ", ", getEntrySimTime());
+    }
+    fprintf(m_hFile, "\"values\" : [ ");
 
     m_processedAnyStats = true;
     m_firstField = true;
@@ -79,6 +79,7 @@ void StatisticOutputTxt::printUsage()
     out.output(" : outputinlineheader = <0|1>  - Output Header inline - Default is 1\n");
     out.output(" : outputsimtime = 0 | 1 - Output Simulation Time - Default is 1\n");
     out.output(" : outputrank = 0 | 1 - Output Rank - Default is 1\n");
+    out.output(" : async = 0 | 1 - Format and write the output on a separate thread - Default is 0\n");
 }
 
 void StatisticOutputTxt::startOfSimulation() 
@@ -87,20 +88,7 @@ void StatisticOutputTxt::startOfSimulation()
     FieldInfoArray_t::iterator it_v;
     
     // Set Filename with Rank if Num Ranks > 1
-    if (1 < Simulation::getSimulation()->getNumRanks().rank) {
-        int rank = Simulation::getSimulation()->getRank().rank;
-        std::string rankstr = "_" + SST::to_string(rank);
-        
-        // Search for any extension        
-        size_t index = m_FilePath.find_last_of(".");
-        if (std::string::npos != index) {
-            // We found a . at the end of the file, insert the rank string
-            m_FilePath.insert(index, rankstr);
-        } else {
-            // No . found, append the rank string
-            m_FilePath += rankstr;
-        }
-    }
+    m_FilePath = getRankFilePath(m_FilePath);
     
     // Open the finalized filename
     if ( !openFile() )
@@ -162,9 +150,9 @@ void StatisticOutputTxt::implStartOutputEntries(StatisticBase* statistic)
     if (true == m_outputSimTime) {
         // Add the Simulation Time to the front
         if (true == m_outputInlineHeader) {
-            sprintf(buffer, "SimTime = %" PRIu64, Simulation::getSimulation()->getCurrentSimCycle());
+            sprintf(buffer, "SimTime = %" PRIu64, getEntrySimTime());
         } else {
-            sprintf(buffer, "%" PRIu64, Simulation::getSimulation()->getCurrentSimCycle());
+            sprintf(buffer, "%" PRIu64, getEntrySimTime());
         }
 
         m_outputBuffer += buffer;
@@ -174,9 +162,9 @@ void StatisticOutputTxt::implStartOutputEntries(StatisticBase* statistic)
     if (true == m_outputRank) {
         // Add the Rank to the front
         if (true == m_outputInlineHeader) {
-            sprintf(buffer, "Rank = %d", Simulation::getSimulation()->getRank().rank);
+            sprintf(buffer, "Rank = %d", getEntryRank());
         } else {
-            sprintf(buffer, "%d", Simulation::getSimulation()->getRank().rank);
+            sprintf(buffer, "%d", getEntryRank());
         }
 
         m_outputBuffer += buffer;
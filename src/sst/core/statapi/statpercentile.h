@@ -0,0 +1,292 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_CORE_PERCENTILE_STATISTIC_
+#define _H_SST_CORE_PERCENTILE_STATISTIC_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+#include "sst/core/sst_types.h"
+#include "sst/core/warnmacros.h"
+#include "sst/core/output.h"
+
+#include "sst/core/statapi/statbase.h"
+#include "sst/core/statapi/statoutput.h"
+
+namespace SST {
+namespace Statistics {
+
+// NOTE: When calling base class members in classes derived from
+//       a templated base class.  The user must use "this->" in
+//       order to call base class members (to avoid a compiler
+//       error) because they are "nondependant named" and the
+//       templated base class is a "dependant named".  The
+//       compiler will not look in dependant named base classes
+//       when looking up independent names.
+// See: http://www.parashift.com/c++-faq-lite/nondependent-name-lookup-members.html
+
+/**
+    \class PercentileStatistic
+
+    Estimates percentiles of a quantity without keeping the values.  Values
+    are counted in log-linear buckets: each power of two is split into
+    2^precision buckets of equal width, so every estimate is within a
+    relative error of 2^-(precision+1).  Memory only depends on the number
+    of powers of two that values span, not on the number of values.
+
+    @tparam NumberBase A template for the basic numerical type of values
+*/
+
+template <typename NumberBase>
+class PercentileStatistic : public Statistic<NumberBase>
+{
+public:
+    SST_ELI_DECLARE_STATISTIC_TEMPLATE(
+        PercentileStatistic,
+        "sst",
+        "PercentileStatistic",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Estimate percentiles of a statistic in bounded memory",
+        "SST::Statistic<T>")
+
+    PercentileStatistic(BaseComponent* comp, const std::string& statName,
+                        const std::string& statSubId, Params& statParams) :
+        Statistic<NumberBase>(comp, statName, statSubId, statParams)
+    {
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("percentiles");
+        allowedKeySet.insert("precision");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        // Process the Parameters
+        Output& out = Output::getDefaultObject();
+        if ( statParams.contains("percentiles") ) {
+            statParams.find_array<double>("percentiles", m_percentiles);
+        } else {
+            m_percentiles = { 50, 90, 99, 99.9 };
+        }
+        for ( double p : m_percentiles ) {
+            if ( !(p > 0 && p <= 100) ) {
+                out.fatal(CALL_INFO, 1, "PercentileStatistic %s: percentile %g is not in (0, 100]\n",
+                          this->getFullStatName().c_str(), p);
+            }
+        }
+
+        uint32_t precision = statParams.find<uint32_t>("precision", 7);
+        if ( precision > 16 ) {
+            out.fatal(CALL_INFO, 1, "PercentileStatistic %s: precision %" PRIu32 " is larger than 16\n",
+                      this->getFullStatName().c_str(), precision);
+        }
+        m_subBuckets = 1 << precision;
+
+        clearStatisticData();
+
+        // Set the Name of this Statistic
+        this->setStatisticTypeName("Percentile");
+    }
+
+    ~PercentileStatistic() {}
+
+protected:
+    /**
+        Count a value N times.  Only the bucket holding the value is updated.
+    */
+    void addData_impl_Ntimes(uint64_t N, NumberBase value) override
+    {
+        double v = static_cast<double>(value);
+        if ( !std::isfinite(v) ) return;
+
+        if ( 0 == m_count || value < m_min ) m_min = value;
+        if ( 0 == m_count || value > m_max ) m_max = value;
+        m_count += N;
+
+        if ( v > 0 ) {
+            m_positive.add(v, N, m_subBuckets);
+        } else if ( v < 0 ) {
+            m_negative.add(-v, N, m_subBuckets);
+        } else {
+            m_zeros += N;
+        }
+    }
+
+    void addData_impl(NumberBase value) override {
+        addData_impl_Ntimes(1, value);
+    }
+
+private:
+    /** Counts for one sign, by magnitude.  Buckets cover the powers of
+     * two from 2^(minExp-1) up, and grow to cover new magnitudes */
+    struct LogBuckets {
+        int                   minExp;
+        std::vector<uint64_t> counts;
+
+        void clear() {
+            minExp = 0;
+            counts.clear();
+        }
+
+        void add(double magnitude, uint64_t N, uint32_t subBuckets) {
+            int exp;
+            double frac = std::frexp(magnitude, &exp);   // frac is in [0.5, 1)
+            uint32_t sub = std::min<uint32_t>((frac - 0.5) * 2 * subBuckets, subBuckets - 1);
+
+            if ( counts.empty() ) {
+                minExp = exp;
+                counts.resize(subBuckets, 0);
+            } else if ( exp < minExp ) {
+                counts.insert(counts.begin(), (size_t)(minExp - exp) * subBuckets, 0);
+                minExp = exp;
+            }
+            size_t index = (size_t)(exp - minExp) * subBuckets + sub;
+            if ( index >= counts.size() ) {
+                counts.resize((index / subBuckets + 1) * subBuckets, 0);
+            }
+            counts[index] += N;
+        }
+
+        /** Midpoint of the values counted in a bucket */
+        double value(size_t index, uint32_t subBuckets) const {
+            int exp = minExp + index / subBuckets;
+            double frac = 0.5 + ((index % subBuckets) + 0.5) / (2.0 * subBuckets);
+            return std::ldexp(frac, exp);
+        }
+    };
+
+    /** Estimate the value at percentile p.  Values are walked in
+     * increasing order: negatives by decreasing magnitude, zeros and then
+     * positives. */
+    NumberBase getPercentile(double p) const
+    {
+        if ( 0 == m_count ) return 0;
+
+        uint64_t rank = std::max<uint64_t>(1, std::ceil(p / 100.0 * m_count));
+        uint64_t seen = 0;
+        double estimate = static_cast<double>(m_max);
+        bool found = false;
+
+        for ( size_t i = m_negative.counts.size(); i > 0 && !found; i-- ) {
+            seen += m_negative.counts[i - 1];
+            if ( seen >= rank ) {
+                estimate = -m_negative.value(i - 1, m_subBuckets);
+                found = true;
+            }
+        }
+        if ( !found ) {
+            seen += m_zeros;
+            if ( seen >= rank ) {
+                estimate = 0;
+                found = true;
+            }
+        }
+        for ( size_t i = 0; i < m_positive.counts.size() && !found; i++ ) {
+            seen += m_positive.counts[i];
+            if ( seen >= rank ) {
+                estimate = m_positive.value(i, m_subBuckets);
+                found = true;
+            }
+        }
+
+        // The exact extremes are known, so keep the estimate inside them
+        estimate = std::max(estimate, static_cast<double>(m_min));
+        estimate = std::min(estimate, static_cast<double>(m_max));
+        if ( std::is_integral<NumberBase>::value ) {
+            estimate = std::round(estimate);
+        }
+        return static_cast<NumberBase>(estimate);
+    }
+
+    void clearStatisticData() override
+    {
+        m_count = 0;
+        m_zeros = 0;
+        m_min = 0;
+        m_max = 0;
+        m_positive.clear();
+        m_negative.clear();
+    }
+
+    void serializeStatisticData(SST::Core::Serialization::serializer& ser) override
+    {
+        StatisticBase::serializeStatisticData(ser);
+        ser & m_count;
+        ser & m_zeros;
+        ser & m_min;
+        ser & m_max;
+        ser & m_positive.minExp;
+        ser & m_positive.counts;
+        ser & m_negative.minExp;
+        ser & m_negative.counts;
+    }
+
+    void registerOutputFields(StatisticOutput* statOutput) override
+    {
+        m_Fields.push_back(statOutput->registerField<uint64_t>  ("Count"));
+        m_Fields.push_back(statOutput->registerField<NumberBase>("Min"));
+        m_Fields.push_back(statOutput->registerField<NumberBase>("Max"));
+
+        for ( double p : m_percentiles ) {
+            // Field names look like P50, P99.9
+            std::stringstream ss;
+            ss << "P" << p;
+            m_Fields.push_back(statOutput->registerField<NumberBase>(ss.str().c_str()));
+        }
+    }
+
+    void outputStatisticData(StatisticOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
+    {
+        uint32_t x = 0;
+        statOutput->outputField(m_Fields[x++], m_count);
+        statOutput->outputField(m_Fields[x++], m_min);
+        statOutput->outputField(m_Fields[x++], m_max);
+
+        for ( double p : m_percentiles ) {
+            statOutput->outputField(m_Fields[x++], getPercentile(p));
+        }
+    }
+
+    bool isStatModeSupported(StatisticBase::StatMode_t mode) const override
+    {
+        if (mode == StatisticBase::STAT_MODE_COUNT) {
+            return true;
+        }
+        if (mode == StatisticBase::STAT_MODE_PERIODIC) {
+            return true;
+        }
+        return false;
+    }
+
+private:
+    // Percentiles to output, in (0, 100]
+    std::vector<double>   m_percentiles;
+
+    // Buckets per power of two
+    uint32_t              m_subBuckets;
+
+    uint64_t              m_count;
+    uint64_t              m_zeros;
+    NumberBase            m_min;
+    NumberBase            m_max;
+    LogBuckets            m_positive;
+    LogBuckets            m_negative;
+
+    std::vector<uint32_t> m_Fields;
+};
+
+} //namespace Statistics
+} //namespace SST
+
+#endif
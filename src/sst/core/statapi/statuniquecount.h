@@ -66,6 +66,12 @@ private:
       uniqueSet.clear();
     }
 
+    void serializeStatisticData(SST::Core::Serialization::serializer& ser) override
+    {
+      StatisticBase::serializeStatisticData(ser);
+      ser & uniqueSet;
+    }
+
     void registerOutputFields(StatisticOutput* statOutput) override
     {
       uniqueCountField = statOutput->registerField<uint64_t>("UniqueItems");
@@ -0,0 +1,173 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_CORE_UNIQUE_COUNT_APPROX_STATISTIC_
+#define _H_SST_CORE_UNIQUE_COUNT_APPROX_STATISTIC_
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "sst/core/sst_types.h"
+#include "sst/core/warnmacros.h"
+#include "sst/core/output.h"
+
+#include "sst/core/statapi/statbase.h"
+
+namespace SST {
+class BaseComponent;
+namespace Statistics {
+
+/**
+    \class UniqueCountApproxStatistic
+
+    Creates a Statistic which estimates the number of unique values provided
+    to it with a HyperLogLog sketch.  Memory is fixed at 2^precision bytes
+    and the standard error of the estimate is about 1.04 / sqrt(2^precision).
+    Outputs the same fields as UniqueCountStatistic.
+
+    @tparam T A template for holding the main data type of this statistic
+*/
+
+template <typename T>
+class UniqueCountApproxStatistic : public Statistic<T>
+{
+public:
+  SST_ELI_DECLARE_STATISTIC_TEMPLATE(
+      UniqueCountApproxStatistic,
+      "sst",
+      "UniqueCountApproxStatistic",
+      SST_ELI_ELEMENT_VERSION(1,0,0),
+      "Estimate unique occurrences of statistic in fixed memory",
+      "SST::Statistic<T>")
+
+    UniqueCountApproxStatistic(BaseComponent* comp, const std::string& statName, const std::string& statSubId, Params& statParams)
+        : Statistic<T>(comp, statName, statSubId, statParams)
+    {
+        // Identify what keys are Allowed in the parameters
+        Params::KeySet_t allowedKeySet;
+        allowedKeySet.insert("precision");
+        statParams.pushAllowedKeys(allowedKeySet);
+
+        precision = statParams.find<uint32_t>("precision", 14);
+        if ( precision < 4 || precision > 18 ) {
+            Output::getDefaultObject().fatal(CALL_INFO, 1,
+                "UniqueCountApproxStatistic %s: precision %" PRIu32 " is not in [4, 18]\n",
+                this->getFullStatName().c_str(), precision);
+        }
+        registers.resize(1 << precision, 0);
+
+        // Set the Name of this Statistic
+        this->setStatisticTypeName("UniqueCountApprox");
+    }
+
+    ~UniqueCountApproxStatistic(){};
+
+protected:
+    /**
+    Present a new value to the Statistic to be included in the unique set
+        @param data New data item to be included in the unique set
+    */
+    void addData_impl(T data) override {
+        uint64_t hash = hashValue(data);
+
+        // The top bits pick a register, which keeps the longest run of
+        // leading zeros seen in the rest of the hash
+        uint32_t index = hash >> (64 - precision);
+        uint64_t rest = hash << precision;
+        uint8_t rank = (0 == rest) ? (64 - precision + 1) : (__builtin_clzll(rest) + 1);
+        if ( rank > registers[index] ) registers[index] = rank;
+    }
+
+    void addData_impl_Ntimes(uint64_t UNUSED(N), T data) override {
+        // Repeats do not change the unique count
+        addData_impl(data);
+    }
+
+private:
+    static uint64_t hashValue(T data)
+    {
+        // Make 0.0 and -0.0 the same value, as std::set would
+        if ( data == 0 ) data = 0;
+
+        uint64_t bits = 0;
+        memcpy(&bits, &data, sizeof(T) < sizeof(bits) ? sizeof(T) : sizeof(bits));
+
+        // splitmix64 finalizer, spreads every input bit over the hash
+        bits ^= bits >> 30;
+        bits *= 0xbf58476d1ce4e5b9ULL;
+        bits ^= bits >> 27;
+        bits *= 0x94d049bb133111ebULL;
+        bits ^= bits >> 31;
+        return bits;
+    }
+
+    uint64_t estimateCount() const
+    {
+        double m = registers.size();
+        double sum = 0;
+        uint32_t zeros = 0;
+        for ( uint8_t r : registers ) {
+            sum += std::ldexp(1.0, -r);
+            if ( 0 == r ) zeros++;
+        }
+
+        double alpha;
+        switch ( registers.size() ) {
+        case 16: alpha = 0.673; break;
+        case 32: alpha = 0.697; break;
+        case 64: alpha = 0.709; break;
+        default: alpha = 0.7213 / (1.0 + 1.079 / m); break;
+        }
+        double estimate = alpha * m * m / sum;
+
+        // Small counts are more accurate from the number of empty registers
+        if ( estimate <= 2.5 * m && zeros > 0 ) {
+            estimate = m * std::log(m / zeros);
+        }
+        return (uint64_t) std::llround(estimate);
+    }
+
+    void clearStatisticData() override
+    {
+        std::fill(registers.begin(), registers.end(), 0);
+    }
+
+    void serializeStatisticData(SST::Core::Serialization::serializer& ser) override
+    {
+        StatisticBase::serializeStatisticData(ser);
+        ser & registers;
+    }
+
+    void registerOutputFields(StatisticOutput* statOutput) override
+    {
+      uniqueCountField = statOutput->registerField<uint64_t>("UniqueItems");
+    }
+
+    void outputStatisticData(StatisticOutput* statOutput, bool UNUSED(EndOfSimFlag)) override
+    {
+      statOutput->outputField(uniqueCountField, estimateCount());
+    }
+
+private:
+    uint32_t precision;
+    std::vector<uint8_t> registers;
+    StatisticOutput::fieldHandle_t uniqueCountField;
+
+};
+
+
+} //namespace Statistics
+} //namespace SST
+
+#endif
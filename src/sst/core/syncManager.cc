@@ -20,9 +20,11 @@
 #include "sst/core/threadSyncQueue.h"
 #include "sst/core/timeConverter.h"
 
+#include "sst/core/rankSyncSerialOverlap.h"
 #include "sst/core/rankSyncSerialSkip.h"
 #include "sst/core/rankSyncParallelSkip.h"
 #include "sst/core/rankSyncParallelSkip.h"
+#include "sst/core/threadSyncNeighborSkip.h"
 #include "sst/core/threadSyncSimpleSkip.h"
 
 #ifdef SST_CONFIG_HAVE_MPI
@@ -98,15 +100,17 @@ public:
 
     /** Register a Link which this Sync Object is responsible for */
     void registerLink(LinkId_t UNUSED(link_id), Link* UNUSED(link)) override {}
-    ActivityQueue* getQueueForThread(int UNUSED(tid)) override { return nullptr; }
+    ActivityQueue* registerRemoteLink(LinkId_t UNUSED(link_id), NewThreadSync* UNUSED(remote)) override { return nullptr; }
 };
 
 
-SyncManager::SyncManager(const RankInfo& rank, const RankInfo& num_ranks, TimeConverter* minPartTC, SimTime_t min_part, const std::vector<SimTime_t>& UNUSED(interThreadLatencies)) :
+SyncManager::SyncManager(const RankInfo& rank, const RankInfo& num_ranks, TimeConverter* minPartTC, SimTime_t min_part, const std::vector<SimTime_t>& interThreadLatencies) :
     Action(),
     rank(rank),
     num_ranks(num_ranks),
     threadSync(nullptr),
+    barrierFreeThreadSync(false),
+    unsynchronized(false),
     min_part(min_part)
 {
     sim = Simulation::getSimulation();
@@ -116,11 +120,14 @@ SyncManager::SyncManager(const RankInfo& rank, const RankInfo& num_ranks, TimeCo
         for ( auto &b : RankExecBarrier ) { b.resize(num_ranks.thread); }
         for ( auto &b : LinkUntimedBarrier ) { b.resize(num_ranks.thread); }
         if ( min_part != MAX_SIMTIME_T ) {
-            if ( num_ranks.thread == 1 ) {
-                rankSync = new RankSyncSerialSkip(/*num_ranks,*/ minPartTC);
+            if ( sim->rankSyncMode == "overlap" ) {
+                rankSync = new RankSyncSerialOverlap(num_ranks, minPartTC);
+            }
+            else if ( num_ranks.thread == 1 ) {
+                rankSync = new RankSyncSerialSkip(/*num_ranks,*/ minPartTC, sim->nonblockingSyncReduce);
             }
             else {
-                rankSync = new RankSyncParallelSkip(num_ranks, minPartTC);
+                rankSync = new RankSyncParallelSkip(num_ranks, minPartTC, sim->nonblockingSyncReduce);
             }
         }
         else {
@@ -133,10 +140,30 @@ SyncManager::SyncManager(const RankInfo& rank, const RankInfo& num_ranks, TimeCo
     // of the active threadsyncs.
     SimTime_t interthread_minlat = sim->getInterThreadMinLatency();
     if ( num_ranks.thread > 1 && interthread_minlat != MAX_SIMTIME_T ) {
-        threadSync = new ThreadSyncSimpleSkip(num_ranks.thread, rank.thread, Simulation::getSimulation());
+        if ( sim->threadSyncMode == "neighbor" ) {
+            threadSync = new ThreadSyncNeighborSkip(num_ranks.thread, rank.thread, Simulation::getSimulation(), interThreadLatencies);
+            barrierFreeThreadSync = true;
+        }
+        else {
+            threadSync = new ThreadSyncSimpleSkip(num_ranks.thread, rank.thread, Simulation::getSimulation());
+        }
     }
     else {
         threadSync = new EmptyThreadSync();
+        unsynchronized = ( min_part == MAX_SIMTIME_T );
+    }
+
+    // Checkpoints are taken at a sync that every thread and rank
+    // meets at with nothing left in flight
+    if ( sim->checkpointPeriod != 0 && !unsynchronized ) {
+        if ( min_part != MAX_SIMTIME_T && sim->rankSyncMode == "overlap" ) {
+            Simulation::getSimulationOutput().fatal(CALL_INFO, 1,
+                "Checkpoints need --rank-sync=skip, the overlapped rank sync always has events in flight\n");
+        }
+        if ( min_part == MAX_SIMTIME_T && barrierFreeThreadSync ) {
+            Simulation::getSimulationOutput().fatal(CALL_INFO, 1,
+                "Checkpoints on a single rank need --thread-sync=skip, the threads never all meet with --thread-sync=neighbor\n");
+        }
     }
 
     exit = sim->getExit();
@@ -163,9 +190,10 @@ SyncManager::registerLink(const RankInfo& to_rank, const RankInfo& from_rank, Li
         // For the local ThreadSync, just need to register the link
         threadSync->registerLink(link_id, link);
 
-        // Need to get target queue from the remote ThreadSync
+        // The local ThreadSync also provides the queue that sends to
+        // the remote ThreadSync
         NewThreadSync* remoteSync = Simulation::instanceVec[to_rank.thread]->syncManager->threadSync;
-        return remoteSync->getQueueForThread(from_rank.thread);
+        return threadSync->registerRemoteLink(link_id, remoteSync);
     }
     else {
         // Different rank.  Send info onto the RankSync
@@ -176,8 +204,13 @@ SyncManager::registerLink(const RankInfo& to_rank, const RankInfo& from_rank, Li
 void
 SyncManager::execute(void)
 {
-    switch ( next_sync_type ) {
+    sync_type_t sync_type = next_sync_type;
+    switch ( sync_type ) {
     case RANK:
+        // Threads that don't sync in lockstep may be waiting on this
+        // one to get to the rank sync
+        threadSync->publishSafeTime(sim->getCurrentSimCycle());
+
         // Need to make sure all threads have reached the sync to
         // guarantee that all events have been sent to the appropriate
         // queues.
@@ -204,7 +237,7 @@ SyncManager::execute(void)
 
         RankExecBarrier[3].wait();
         
-        if ( exit != nullptr && rank.thread == 0 ) exit->check();
+        if ( exit != nullptr && rank.thread == 0 && !rankSync->checksExit() ) exit->check();
 
         RankExecBarrier[4].wait();
 
@@ -218,16 +251,37 @@ SyncManager::execute(void)
         threadSync->execute();
         
         if ( /*num_ranks.rank == 1*/ min_part == MAX_SIMTIME_T ) {
-            if ( exit->getRefCount() == 0 ) {
-                endSimulation(exit->getEndTime());
+            SimTime_t end;
+            if ( exit->isDone(end) && threadSync->reachedEnd(end) ) {
+                endSimulation(end);
             }
         }
         
+        break;
+    case CHECKPOINT:
+        // Nothing to synchronize, this thread only stops to checkpoint
         break;
     default:
         break;
     }
+
+    // Everything sent to this thread before now has been delivered to
+    // it.  Between rank syncs only the threads of one rank meet, so
+    // multi-rank runs only checkpoint at rank syncs.
+    if ( sim->getCurrentSimCycle() >= sim->nextCheckpoint && !sim->endSim &&
+         ( sync_type != THREAD || min_part == MAX_SIMTIME_T ) ) {
+        sim->checkpoint();
+    }
+
     computeNextInsert();
+    if ( sync_type == CHECKPOINT ) return;
+
+    if ( barrierFreeThreadSync ) {
+        // This thread won't execute anything before its next
+        // activity, which now includes its next sync
+        threadSync->publishSafeTime(sim->getNextActivityTime());
+        if ( sync_type == THREAD ) return;
+    }
     RankExecBarrier[5].wait();
 }
 
@@ -265,10 +319,21 @@ SyncManager::prepareForComplete()
     if ( rank.thread == 0 ) rankSync->prepareForComplete();
 }
 
+void
+SyncManager::releaseThreads()
+{
+    threadSync->publishSafeTime(MAX_SIMTIME_T);
+}
+
 void
 SyncManager::computeNextInsert()
 {
-    if ( rankSync->getNextSyncTime() <= threadSync->getNextSyncTime() ) {
+    if ( unsynchronized && sim->nextCheckpoint != MAX_SIMTIME_T ) {
+        // No sync will stop this thread, so stop for the checkpoint
+        next_sync_type = CHECKPOINT;
+        sim->insertActivity(sim->nextCheckpoint, this);
+    }
+    else if ( rankSync->getNextSyncTime() <= threadSync->getNextSyncTime() ) {
         next_sync_type = RANK;
         sim->insertActivity(rankSync->getNextSyncTime(), this);
     }
@@ -15,9 +15,11 @@
 #include "sst/core/sst_types.h"
 
 #include "sst/core/action.h"
+#include "sst/core/activityQueue.h"
 #include "sst/core/link.h"
 #include "sst/core/rankInfo.h"
 #include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
 
 #include <vector>
 #include <unordered_map>
@@ -45,6 +47,10 @@ public:
 
     virtual SimTime_t getNextSyncTime() { return nextSyncTime; }
 
+    /** True if execute() also reduces the Exit status, so that
+     * Exit::check() must not be called */
+    virtual bool checksExit() { return false; }
+
     // void setMaxPeriod(TimeConverter* period) {max_period = period;}
     TimeConverter* getMaxPeriod() {return max_period;}
 
@@ -84,12 +90,24 @@ public:
 
     virtual SimTime_t getNextSyncTime() { return nextSyncTime; }
 
+    /** Tell the other threads that this thread will not execute
+     * anything before time.  Only used by syncs that don't keep the
+     * threads in lockstep. */
+    virtual void publishSafeTime(SimTime_t UNUSED(time)) {}
+
+    /** Called at a sync once every Exit reference is gone, with the
+     * end time.  Returns true if this thread should stop now; until
+     * then it keeps syncing. */
+    virtual bool reachedEnd(SimTime_t UNUSED(end)) { return true; }
+
     void setMaxPeriod(TimeConverter* period) {max_period = period;}
     TimeConverter* getMaxPeriod() {return max_period;}
 
     /** Register a Link which this Sync Object is responsible for */
     virtual void registerLink(LinkId_t link_id, Link* link) = 0;
-    virtual ActivityQueue* getQueueForThread(int tid) = 0;
+    /** Register a Link which sends to the thread that owns remote
+     * @return the queue the link should send into */
+    virtual ActivityQueue* registerRemoteLink(LinkId_t link_id, NewThreadSync* remote) = 0;
     
 protected:
     SimTime_t nextSyncTime;
@@ -107,6 +125,14 @@ protected:
         link->sendUntimedData_sync(data);
     }
 
+    Link* getPairLink(Link* link) {
+        return link->pair_link;
+    }
+
+    void insertIntoRecvQueue(Link* link, Activity* act) {
+        link->recvQueue->insert(act);
+    }
+
 private:
 };
 
@@ -124,13 +150,19 @@ public:
     /** Finish link configuration */
     void finalizeLinkConfigurations();
     void prepareForComplete();
+    /** Let threads waiting on this one run to the end of the
+     * simulation */
+    void releaseThreads();
+    /** Let threads waiting on this one run up to time plus the
+     * lookahead */
+    void publishSafeTime(SimTime_t time) { threadSync->publishSafeTime(time); }
 
     void print(const std::string& header, Output &out) const override;
 
     uint64_t getDataSize() const;
 
 private:
-    enum sync_type_t { RANK, THREAD};
+    enum sync_type_t { RANK, THREAD, CHECKPOINT };
 
     RankInfo rank;
     RankInfo num_ranks;
@@ -142,6 +174,10 @@ private:
     static NewRankSync*     rankSync;
     static SimTime_t        next_rankSync;
     NewThreadSync*   threadSync;
+    /* Thread syncs don't need the threads to meet */
+    bool             barrierFreeThreadSync;
+    /* Nothing sends events to this thread from other threads or ranks */
+    bool             unsynchronized;
     Exit* exit;
     Simulation * sim;
     
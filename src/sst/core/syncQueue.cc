@@ -53,6 +53,13 @@ SyncQueue::insert(Activity* activity)
     activities.push_back(activity);
 }
 
+void
+SyncQueue::insertBatch(Activity* const* batch, size_t count)
+{
+    std::lock_guard<Spinlock> lock(slock);
+    activities.insert(activities.end(), batch, batch + count);
+}
+
 Activity*
 SyncQueue::pop()
 {
@@ -79,6 +86,13 @@ SyncQueue::clear()
     activities.clear();
 }
 
+// Records in the buffer are padded to keep the headers aligned
+static inline size_t
+padRecord(size_t size)
+{
+    return (size + 7) & ~static_cast<size_t>(7);
+}
+
 char*
 SyncQueue::getData()
 {
@@ -86,11 +100,26 @@ SyncQueue::getData()
 
     serializer ser;
 
-    ser.start_sizing();
-
-    ser & activities;
-
-    size_t size = ser.size();
+    // Size everything first.  Fixed-layout events only need their
+    // data size, everything else goes through the serializer.
+    size_t size = 0;
+    sizes.resize(activities.size());
+    for ( size_t i = 0; i < activities.size(); i++ ) {
+        Event* ev = static_cast<Event*>(activities[i]);
+        void* data;
+        size_t data_size;
+#ifndef __SST_DEBUG_EVENT_TRACKING__
+        if ( ev->getTrivialData(data, data_size) ) {
+            sizes[i] = 0;
+            size += sizeof(EventHeader) + padRecord(data_size);
+            continue;
+        }
+#endif
+        ser.start_sizing();
+        ser & activities[i];
+        sizes[i] = ser.size();
+        size += sizeof(EventHeader) + padRecord(sizes[i]);
+    }
 
     if ( buf_size < ( size + sizeof(SyncQueue::Header) ) ) {
         if ( buffer != nullptr ) {
@@ -100,21 +129,82 @@ SyncQueue::getData()
         buf_size = size + sizeof(SyncQueue::Header);
         buffer = new char[buf_size];
     }
-        
-    ser.start_packing(buffer + sizeof(SyncQueue::Header), size);
 
-    ser & activities;
+    char* ptr = buffer + sizeof(SyncQueue::Header);
+    for ( size_t i = 0; i < activities.size(); i++ ) {
+        Event* ev = static_cast<Event*>(activities[i]);
+        EventHeader* ehdr = reinterpret_cast<EventHeader*>(ptr);
+        ptr += sizeof(EventHeader);
+
+        if ( sizes[i] == 0 ) {
+            void* data;
+            size_t data_size;
+            ev->getTrivialData(data, data_size);
+            ehdr->cls_id = ev->cls_id();
+            ehdr->size = data_size;
+            ehdr->delivery_time = ev->getDeliveryTime();
+            ehdr->link_id = ev->getLinkId();
+            ehdr->priority = ev->getPriority();
+            if ( data_size ) ::memcpy(ptr, data, data_size);
+        }
+        else {
+            ehdr->cls_id = serializable::NullClsId;
+            ehdr->size = sizes[i];
+            ser.start_packing(ptr, sizes[i]);
+            ser & activities[i];
+        }
+        ptr += padRecord(ehdr->size);
 
-    // Delete all the events
-    for ( unsigned int i = 0; i < activities.size(); i++ ) {
-        delete activities[i];
+        // Delete the event
+        delete ev;
     }
+
+    SyncQueue::Header* hdr = static_cast<SyncQueue::Header*>(static_cast<void*>(buffer));
+    hdr->count = activities.size();
     activities.clear();
 
     // Set the size field in the header
-    static_cast<SyncQueue::Header*>(static_cast<void*>(buffer))->buffer_size = size + sizeof(SyncQueue::Header);
+    hdr->buffer_size = size + sizeof(SyncQueue::Header);
     
     return buffer;
 }
 
+void
+SyncQueue::unpackData(char* buffer, std::vector<Activity*>& activities)
+{
+    SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(buffer);
+    char* ptr = buffer + sizeof(SyncQueue::Header);
+    char* end = buffer + hdr->buffer_size;
+
+    activities.reserve(activities.size() + hdr->count);
+
+    serializer ser;
+    while ( ptr < end ) {
+        EventHeader* ehdr = reinterpret_cast<EventHeader*>(ptr);
+        ptr += sizeof(EventHeader);
+
+        if ( ehdr->cls_id == serializable::NullClsId ) {
+            Activity* act = nullptr;
+            ser.start_unpacking(ptr, ehdr->size);
+            ser & act;
+            activities.push_back(act);
+        }
+        else {
+            // Construct the event (from the Activity memory pools)
+            // and copy its data straight out of the buffer
+            Event* ev = static_cast<Event*>(serializable_factory::get_serializable(ehdr->cls_id));
+            ev->setTrivialHeader(ehdr->delivery_time, ehdr->link_id, ehdr->priority);
+            void* data;
+            size_t data_size;
+            ev->getTrivialData(data, data_size);
+            if ( data_size != ehdr->size ) {
+                Simulation::getSimulationOutput().fatal(CALL_INFO, 1, "Size mismatch unpacking fixed-layout event of type %s\n", ev->cls_name());
+            }
+            if ( data_size ) ::memcpy(data, ptr, data_size);
+            activities.push_back(ev);
+        }
+        ptr += padRecord(ehdr->size);
+    }
+}
+
 } // namespace SST
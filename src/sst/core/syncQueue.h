@@ -34,6 +34,19 @@ public:
         uint32_t count;
         uint32_t buffer_size;
     };
+
+    /** Sent ahead of each event in the buffer.  Events that use the
+     * fixed-layout format (see ImplementTriviallySerializable) are
+     * tagged with their class id and followed by a copy of their
+     * data.  All others have cls_id set to NullClsId and are followed
+     * by the output of the serializer. */
+    struct EventHeader {
+        uint32_t  cls_id;
+        uint32_t  size;
+        SimTime_t delivery_time;
+        LinkId_t  link_id;
+        int32_t   priority;
+    };
     
     SyncQueue();
     ~SyncQueue();
@@ -41,6 +54,7 @@ public:
     bool empty() override;
     int size() override;
     void insert(Activity* activity) override;
+    void insertBatch(Activity* const* batch, size_t count) override;
     Activity* pop() override; // Not a good idea for this particular class
     Activity* front() override;
 
@@ -49,6 +63,8 @@ public:
     void clear();
     /** Accessor method to the internal queue */
     char* getData();
+    /** Recreate the activities in a buffer returned by getData() */
+    static void unpackData(char* buffer, std::vector<Activity*>& activities);
 
     uint64_t getDataSize() {
         return buf_size + (activities.capacity() * sizeof(Activity*));
@@ -58,6 +74,8 @@ private:
     char* buffer;
     size_t buf_size;
     std::vector<Activity*> activities;
+    /* Serialized size of each activity, 0 for fixed-layout events */
+    std::vector<uint32_t> sizes;
 
     Core::ThreadSafe::Spinlock slock;
 };
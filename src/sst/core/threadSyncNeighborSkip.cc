@@ -0,0 +1,155 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "sst/core/threadSyncNeighborSkip.h"
+
+#include "sst/core/output.h"
+#include "sst/core/profile.h"
+#include "sst/core/simulation.h"
+
+namespace SST {
+
+ThreadSyncNeighborSkip::SafeTime* ThreadSyncNeighborSkip::safeTimes = nullptr;
+
+ThreadSyncNeighborSkip::ThreadSyncNeighborSkip(int num_threads, int thread, Simulation* sim, const std::vector<SimTime_t>& latencies) :
+    ThreadSyncSimpleSkip(num_threads, thread, sim),
+    maxDrift(sim->getInterThreadMaxLookahead()),
+    waitTime(0.0)
+{
+    // Other threads don't touch safeTimes until the simulation runs
+    if ( thread == 0 ) {
+        safeTimes = new SafeTime[num_threads];
+    }
+
+    SimTime_t min_lookahead = MAX_SIMTIME_T;
+    for ( int i = 0; i < num_threads; i++ ) {
+        if ( i == thread || latencies[i] == MAX_SIMTIME_T ) continue;
+        neighbors.push_back({i, latencies[i]});
+        if ( latencies[i] < min_lookahead ) min_lookahead = latencies[i];
+    }
+
+    // Nobody has advanced yet, so the first horizon is just the
+    // shortest lookahead.  Threads with no neighbors still sync
+    // periodically so they see the exit condition.
+    if ( min_lookahead != MAX_SIMTIME_T ) nextSyncTime = sim->getCurrentSimCycle() + min_lookahead;
+}
+
+ThreadSyncNeighborSkip::~ThreadSyncNeighborSkip()
+{
+    if ( waitTime > 0.0 )
+        Output::getDefaultObject().verbose(CALL_INFO, 1, 0, "ThreadSyncNeighborSkip total wait time: %lg seconds.\n", waitTime);
+    if ( thread == 0 ) {
+        delete[] safeTimes;
+        safeTimes = nullptr;
+    }
+}
+
+void
+ThreadSyncNeighborSkip::publishSafeTime(SimTime_t time)
+{
+    safeTimes[thread].time.store(time, std::memory_order_release);
+}
+
+SimTime_t
+ThreadSyncNeighborSkip::getHorizon() const
+{
+    SimTime_t horizon = MAX_SIMTIME_T;
+    for ( auto& n : neighbors ) {
+        SimTime_t safe = safeTimes[n.thread].time.load(std::memory_order_acquire);
+        if ( safe >= MAX_SIMTIME_T - n.lookahead ) continue;
+        if ( safe + n.lookahead < horizon ) horizon = safe + n.lookahead;
+    }
+
+    // This thread's own safe time is included, so the earliest thread
+    // can always advance
+    if ( maxDrift != MAX_SIMTIME_T ) {
+        SimTime_t earliest = MAX_SIMTIME_T;
+        for ( int i = 0; i < num_threads; i++ ) {
+            SimTime_t safe = safeTimes[i].time.load(std::memory_order_acquire);
+            if ( safe < earliest ) earliest = safe;
+        }
+        if ( earliest < MAX_SIMTIME_T - maxDrift && earliest + maxDrift < horizon ) horizon = earliest + maxDrift;
+    }
+    return horizon;
+}
+
+void
+ThreadSyncNeighborSkip::setNextSyncTime(SimTime_t horizon)
+{
+    // Don't go more than a period past the next local activity, so
+    // the exit condition is still checked once every neighbor is
+    // done
+    SimTime_t next = sim->getNextActivityTime();
+    if ( next < MAX_SIMTIME_T - my_max_period && next + my_max_period < horizon ) {
+        horizon = next + my_max_period;
+    }
+    nextSyncTime = horizon;
+}
+
+bool
+ThreadSyncNeighborSkip::reachedEnd(SimTime_t end)
+{
+    // The safe times were read before the exit was, so no thread can
+    // be past end plus maxDrift yet, and all of them stop there
+    if ( maxDrift == MAX_SIMTIME_T || end >= MAX_SIMTIME_T - maxDrift ) return true;
+    SimTime_t stop = end + maxDrift;
+    if ( sim->getCurrentSimCycle() >= stop ) return true;
+    if ( nextSyncTime > stop ) nextSyncTime = stop;
+    return false;
+}
+
+void
+ThreadSyncNeighborSkip::after()
+{
+    // Only called for rank syncs, where every thread has published
+    // the sync time, so the horizon is already past it
+    SimTime_t horizon = getHorizon();
+    before();
+    setNextSyncTime(horizon);
+}
+
+void
+ThreadSyncNeighborSkip::execute()
+{
+    SimTime_t now = sim->getCurrentSimCycle();
+    publishSafeTime(now);
+
+    // The safe times have to be read before draining, so that
+    // everything the neighbors sent before publishing them is
+    // received
+    SimTime_t horizon = getHorizon();
+    before();
+    if ( horizon <= now ) {
+        auto startTime = SST::Core::Profile::now();
+        uint32_t count = 0;
+        do {
+            count++;
+            if ( count < 1024 ) {
+#if ( defined( __amd64 ) || defined( __amd64__ ) || \
+        defined( __x86_64 ) || defined( __x86_64__ ) )
+                _mm_pause();
+#elif defined(__PPC64__)
+                asm volatile( "or 27, 27, 27" ::: "memory" );
+#endif
+            } else {
+                std::this_thread::yield();
+            }
+            horizon = getHorizon();
+            before();
+        } while ( horizon <= now );
+        waitTime += SST::Core::Profile::getElapsed(startTime);
+    }
+
+    setNextSyncTime(horizon);
+}
+
+} // namespace SST
@@ -0,0 +1,87 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_THREADSYNCNEIGHBORSKIP_H
+#define SST_CORE_THREADSYNCNEIGHBORSKIP_H
+
+#include "sst/core/sst_types.h"
+
+#include <atomic>
+#include <vector>
+
+#include "sst/core/threadSyncSimpleSkip.h"
+
+namespace SST {
+
+class Simulation;
+
+/**
+ * Thread sync that does not use barriers.
+ *
+ * Each thread publishes a safe time: a time before which it will not
+ * execute anything else.  Anything it sends afterwards arrives no
+ * earlier than its safe time plus the latency of the link.  A thread
+ * only reads the safe times of the threads it has links with, and
+ * may run up to, but not including, the earliest of those plus the
+ * link latency.  It only waits when one of those threads is behind.
+ *
+ * Threads no longer sync at the same times.  So that they can still
+ * all stop at the same cycle, none may run more than the longest
+ * lookahead between two threads past the earliest safe time of any
+ * thread.  When the primary components end the simulation no thread
+ * is past the end time plus that lookahead yet, and every thread
+ * stops there.
+ */
+class ThreadSyncNeighborSkip : public ThreadSyncSimpleSkip {
+public:
+    /** Create a new ThreadSync object
+     * @param latencies Minimum link latency to each other thread,
+     * MAX_SIMTIME_T for threads with no links to this one */
+    ThreadSyncNeighborSkip(int num_threads, int thread, Simulation* sim, const std::vector<SimTime_t>& latencies);
+    ~ThreadSyncNeighborSkip();
+
+    void after() override;
+    void execute(void) override;
+
+    void publishSafeTime(SimTime_t time) override;
+    bool reachedEnd(SimTime_t end) override;
+
+private:
+    struct CACHE_ALIGNED_T SafeTime {
+        SafeTime() : time(0) {}
+        std::atomic<SimTime_t> time;
+    };
+
+    struct neighbor_t {
+        int thread;
+        SimTime_t lookahead;
+    };
+
+    /** Earliest time an event not yet received could be delivered
+     * to this thread */
+    SimTime_t getHorizon() const;
+    /** Pick the next sync time once everything before horizon has
+     * been received */
+    void setNextSyncTime(SimTime_t horizon);
+
+    std::vector<neighbor_t> neighbors;
+    /* How far any thread may run past the earliest safe time */
+    SimTime_t maxDrift;
+    double waitTime;
+
+    /* Published safe time of each thread */
+    static SafeTime* safeTimes;
+};
+
+
+} // namespace SST
+
+#endif // SST_CORE_THREADSYNCNEIGHBORSKIP_H
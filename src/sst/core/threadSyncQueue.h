@@ -46,6 +46,11 @@ public:
     void insert(Activity* activity) override {
         activities.push_back(activity);
     }
+
+    /** Insert a batch of activities into the queue */
+    void insertBatch(Activity* const* batch, size_t count) override {
+        activities.insert(activities.end(), batch, batch + count);
+    }
     
     /** Not supported */
     Activity* front() override {
@@ -25,16 +25,13 @@ SimTime_t ThreadSyncSimpleSkip::localMinimumNextActivityTime = 0;
 /** Create a new ThreadSyncSimpleSkip object */
 ThreadSyncSimpleSkip::ThreadSyncSimpleSkip(int num_threads, int thread, Simulation* sim) :
     NewThreadSync(),
+    inbound(num_threads),
     num_threads(num_threads),
     thread(thread),
     sim(sim),
     totalWaitTime(0.0)
 {
     // TraceFunction trace(CALL_INFO_LONG);
-    for ( int i = 0; i < num_threads; i++ ) {
-        queues.push_back(new ThreadSyncQueue());
-    }
-
     if ( sim->getRank().thread == 0 ) {
         barrier[0].resize(num_threads);
         barrier[1].resize(num_threads);
@@ -45,17 +42,17 @@ ThreadSyncSimpleSkip::ThreadSyncSimpleSkip(int num_threads, int thread, Simulati
     else single_rank = true;
 
     my_max_period = sim->getInterThreadMinLatency();
-    nextSyncTime = my_max_period;
+    nextSyncTime = sim->getCurrentSimCycle() + my_max_period;
 }
 
 ThreadSyncSimpleSkip::~ThreadSyncSimpleSkip()
 {
     if ( totalWaitTime > 0.0 )
         Output::getDefaultObject().verbose(CALL_INFO, 1, 0, "ThreadSyncSimpleSkip total wait time: %lg seconds.\n", totalWaitTime);
-    for ( int i = 0; i < num_threads; i++ ) {
-        delete queues[i];
+    for ( auto queue : link_queues ) {
+        delete queue;
     }
-    queues.clear();
+    link_queues.clear();
 }
 
 void
@@ -65,30 +62,33 @@ ThreadSyncSimpleSkip::registerLink(LinkId_t link_id, Link* link)
 }
 
 ActivityQueue*
-ThreadSyncSimpleSkip::getQueueForThread(int tid)
+ThreadSyncSimpleSkip::registerRemoteLink(LinkId_t link_id, NewThreadSync* remote)
 {
-    return queues[tid];
+    // All threads use the same kind of ThreadSync
+    ThreadSyncSimpleSkip* peer = static_cast<ThreadSyncSimpleSkip*>(remote);
+    LinkQueue* queue = new LinkQueue(link_id, peer, peer->inbound.getLane(thread));
+    link_queues.push_back(queue);
+    return queue;
 }
 
 void
-ThreadSyncSimpleSkip::before()
+ThreadSyncSimpleSkip::LinkQueue::insert(Activity* activity)
 {
-    // Empty all the queues and send events on the links
-    for ( size_t i = 0; i < queues.size(); i++ ) {
-        ThreadSyncQueue* queue = queues[i];
-        std::vector<Activity*>& vec = queue->getVector();
-        for ( size_t j = 0; j < vec.size(); j++ ) {
-            Event* ev = static_cast<Event*>(vec[j]);
-            auto link = link_map.find(ev->getLinkId());
-            if (link == link_map.end()) {
-                Simulation::getSimulationOutput().fatal(CALL_INFO,1,"Link not found in map!\n");
-            } else {
-                SimTime_t delay = ev->getDeliveryTime() - sim->getCurrentSimCycle();
-                link->second->send(delay,ev);
-            }
-        }
-        queue->clear();
+    if ( target != nullptr ) {
+        static_cast<Event*>(activity)->setDeliveryLink(id, target);
     }
+    lane->push(activity);
+}
+
+void
+ThreadSyncSimpleSkip::before()
+{
+    // Events already point at their delivery link, so they go
+    // straight into the link's queue
+    inbound.drain([this](Activity* act) {
+            Event* ev = static_cast<Event*>(act);
+            insertIntoRecvQueue(ev->getDeliveryLink(), ev);
+        });
 }
 
 void
@@ -119,20 +119,15 @@ ThreadSyncSimpleSkip::processLinkUntimedData()
 {
     // Need to walk through all the queues and send the data to the
     // correct links
-    for ( int i = 0; i < num_threads; i++ ) {
-        ThreadSyncQueue* queue = queues[i];
-        std::vector<Activity*>& vec = queue->getVector();
-        for ( size_t j = 0; j < vec.size(); j++ ) {
-            Event* ev = static_cast<Event*>(vec[j]);
+    inbound.drain([this](Activity* act) {
+            Event* ev = static_cast<Event*>(act);
             auto link = link_map.find(ev->getLinkId());
             if (link == link_map.end()) {
                 Simulation::getSimulationOutput().fatal(CALL_INFO,1,"Link not found in map!\n");
             } else {
                 sendUntimedData_sync(link->second,ev);
             }
-        }
-        queue->clear();
-    }
+        });
 }
 
 void
@@ -140,6 +135,17 @@ ThreadSyncSimpleSkip::finalizeLinkConfigurations() {
     for (auto i = link_map.begin() ; i != link_map.end() ; ++i) {
         finalizeConfiguration(i->second);
     }
+
+    // All threads are wired up by now, so look up the link each
+    // remote thread delivers to.  The remote link_map is no longer
+    // being modified.
+    for ( auto queue : link_queues ) {
+        auto link = queue->remote->link_map.find(queue->id);
+        if ( link == queue->remote->link_map.end() ) {
+            Simulation::getSimulationOutput().fatal(CALL_INFO,1,"Link not found in map!\n");
+        }
+        queue->target = getPairLink(link->second);
+    }
 }
 
 void
@@ -149,12 +155,6 @@ ThreadSyncSimpleSkip::prepareForComplete() {
     }
 }
 
-uint64_t
-ThreadSyncSimpleSkip::getDataSize() const {
-    size_t count = 0;
-    return count;
-}
-
 
 Core::ThreadSafe::Barrier ThreadSyncSimpleSkip::barrier[3];
 
@@ -18,7 +18,7 @@
 
 #include "sst/core/action.h"
 #include "sst/core/syncManager.h"
-#include "sst/core/threadSyncQueue.h"
+#include "sst/core/threadsafe.h"
 
 namespace SST {
 
@@ -28,7 +28,6 @@ class TimeConverter;
 class Exit;
 class Event;
 class Simulation;
-class ThreadSyncQueue;
 
 class ThreadSyncSimpleSkip : public NewThreadSync {
 public:
@@ -50,14 +49,42 @@ public:
 
     /** Register a Link which this Sync Object is responsible for */
     void registerLink(LinkId_t link_id, Link* link) override;
-    ActivityQueue* getQueueForThread(int tid) override;
-
-    uint64_t getDataSize() const;
+    ActivityQueue* registerRemoteLink(LinkId_t link_id, NewThreadSync* remote) override;
 
     // static void disable() { disabled = true; barrier.disable(); }
 
-private:
-    std::vector<ThreadSyncQueue*> queues;
+protected:
+    typedef Core::ThreadSafe::MPSCQueue<Activity*> queue_t;
+
+    /**
+     * Queue that a link sending to another thread inserts into.  Once
+     * links are configured, each event is pointed at the link on the
+     * receiving thread before it is handed over, so that thread can
+     * put it straight into the link's queue.
+     */
+    class LinkQueue : public ActivityQueue {
+    public:
+        LinkQueue(LinkId_t id, ThreadSyncSimpleSkip* remote, queue_t::Lane* lane) :
+            ActivityQueue(), id(id), remote(remote), lane(lane), target(nullptr)
+        {}
+
+        bool empty() override { return true; }
+        int size() override { return 0; }
+        Activity* pop() override { return nullptr; }
+        Activity* front() override { return nullptr; }
+
+        void insert(Activity* activity) override;
+
+        LinkId_t id;
+        ThreadSyncSimpleSkip* remote;
+        queue_t::Lane* lane;
+        /* Link on the remote thread that events are delivered to */
+        Link* target;
+    };
+
+    /* Events sent to this thread, one lane per sending thread */
+    queue_t inbound;
+    std::vector<LinkQueue*> link_queues;
     std::unordered_map<LinkId_t, Link*> link_map;
     SimTime_t my_max_period;
     int num_threads;
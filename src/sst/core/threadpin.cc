@@ -0,0 +1,199 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "sst/core/threadpin.h"
+
+#include "sst/core/warnmacros.h"
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+#ifdef HAVE_SCHED_SETAFFINITY
+#include <dirent.h>
+#include <sched.h>
+#endif
+
+
+using namespace SST::Core;
+
+#ifdef HAVE_SCHED_SETAFFINITY
+
+/* Parse a sysfs CPU list such as "0-3,8-11" */
+static std::vector<int> readCpuList(const std::string& path)
+{
+    std::vector<int> cpus;
+    FILE* fp = fopen(path.c_str(), "r");
+    if ( nullptr == fp ) return cpus;
+
+    char buffer[4096];
+    if ( nullptr != fgets(buffer, sizeof(buffer), fp) ) {
+        char* next = buffer;
+        while ( *next != '\0' && *next != '\n' ) {
+            char* end;
+            long first = strtol(next, &end, 10);
+            if ( end == next ) break;
+            long last = first;
+            if ( *end == '-' ) {
+                next = end + 1;
+                last = strtol(next, &end, 10);
+            }
+            for ( long cpu = first; cpu <= last; cpu++ ) cpus.push_back(cpu);
+            next = ( *end == ',' ) ? end + 1 : end;
+        }
+    }
+    fclose(fp);
+    return cpus;
+}
+
+/* The allowed CPUs grouped by NUMA node.  Without NUMA information
+ * they all form one node. */
+static std::vector<std::vector<int> > allowedNodes(const cpu_set_t& allowed)
+{
+    std::vector<std::vector<int> > nodes;
+    std::vector<int> node_ids;
+    DIR* dir = opendir("/sys/devices/system/node");
+    if ( nullptr != dir ) {
+        struct dirent* entry;
+        while ( nullptr != (entry = readdir(dir)) ) {
+            int id;
+            char extra;
+            if ( 1 == sscanf(entry->d_name, "node%d%c", &id, &extra) ) node_ids.push_back(id);
+        }
+        closedir(dir);
+    }
+    std::sort(node_ids.begin(), node_ids.end());
+
+    std::vector<uint8_t> placed(CPU_SETSIZE, 0);
+    for ( int id : node_ids ) {
+        std::vector<int> cpus;
+        for ( int cpu : readCpuList("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist") ) {
+            if ( cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed) && !placed[cpu] ) {
+                cpus.push_back(cpu);
+                placed[cpu] = 1;
+            }
+        }
+        if ( !cpus.empty() ) nodes.push_back(cpus);
+    }
+
+    // CPUs no node listed
+    std::vector<int> rest;
+    for ( int cpu = 0; cpu < CPU_SETSIZE; cpu++ ) {
+        if ( CPU_ISSET(cpu, &allowed) && !placed[cpu] ) rest.push_back(cpu);
+    }
+    if ( !rest.empty() ) nodes.push_back(rest);
+    return nodes;
+}
+
+/* This rank's position among the ranks on its node that may run on
+ * exactly the same CPUs, and how many of them there are.  Returns
+ * false if another rank on the node may run on only some of them. */
+static bool sharingRanks(const cpu_set_t& allowed, uint32_t& index, uint32_t& count)
+{
+    index = 0;
+    count = 1;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm node;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node);
+    int node_rank, node_size;
+    MPI_Comm_rank(node, &node_rank);
+    MPI_Comm_size(node, &node_size);
+    std::vector<cpu_set_t> masks(node_size);
+    MPI_Allgather(&allowed, sizeof(cpu_set_t), MPI_BYTE, masks.data(), sizeof(cpu_set_t), MPI_BYTE, node);
+    MPI_Comm_free(&node);
+
+    count = 0;
+    for ( int r = 0; r < node_size; r++ ) {
+        if ( CPU_EQUAL(&masks[r], &allowed) ) {
+            if ( r < node_rank ) index++;
+            count++;
+            continue;
+        }
+        cpu_set_t common;
+        CPU_AND(&common, &masks[r], &allowed);
+        if ( CPU_COUNT(&common) != 0 ) return false;
+    }
+#endif
+    return true;
+}
+
+std::vector<std::vector<int> > SST::Core::threadCpuSets(const std::string& mode, uint32_t num_threads, std::string& why)
+{
+    std::vector<std::vector<int> > sets;
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool known = ( 0 == sched_getaffinity(0, sizeof(allowed), &allowed) );
+
+    // Every rank has to take part, even one that won't bind
+    uint32_t index, count;
+    if ( !sharingRanks(allowed, index, count) ) {
+        why = "Another rank on this node may run on some, but not all, of the same CPUs";
+        return sets;
+    }
+    std::vector<std::vector<int> > nodes;
+    if ( known ) nodes = allowedNodes(allowed);
+    if ( nodes.empty() || num_threads == 0 ) {
+        why = "Threads cannot be bound to CPUs on this platform";
+        return sets;
+    }
+
+    // Ranks that share the CPUs each take a consecutive block of
+    // slots.  Threads are handed out in blocks so that neighboring
+    // threads, which the partitioners give neighboring parts of the
+    // graph, share a node.
+    uint64_t slots = (uint64_t)count * num_threads;
+    uint64_t first = (uint64_t)index * num_threads;
+    if ( mode == "numa" ) {
+        for ( uint32_t t = 0; t < num_threads; t++ ) {
+            sets.push_back(nodes[(first + t) * nodes.size() / slots]);
+        }
+    }
+    else if ( mode == "core" ) {
+        std::vector<int> cpus;
+        for ( auto& node : nodes ) cpus.insert(cpus.end(), node.begin(), node.end());
+        for ( uint32_t t = 0; t < num_threads; t++ ) {
+            sets.push_back(std::vector<int>(1, cpus[(first + t) * cpus.size() / slots]));
+        }
+    }
+    return sets;
+}
+
+bool SST::Core::pinThread(const std::vector<int>& cpus)
+{
+    if ( cpus.empty() ) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for ( int cpu : cpus ) CPU_SET(cpu, &set);
+    // On Linux a pid of 0 is the calling thread
+    return 0 == sched_setaffinity(0, sizeof(set), &set);
+}
+
+#else
+
+std::vector<std::vector<int> > SST::Core::threadCpuSets(const std::string& UNUSED(mode), uint32_t UNUSED(num_threads), std::string& why)
+{
+    why = "Threads cannot be bound to CPUs on this platform";
+    return std::vector<std::vector<int> >();
+}
+
+bool SST::Core::pinThread(const std::vector<int>& UNUSED(cpus))
+{
+    return false;
+}
+
+#endif
@@ -0,0 +1,38 @@
+// Copyright 2009-2019 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2019, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_CORE_THREADPIN
+#define _H_SST_CORE_THREADPIN
+
+#include <inttypes.h>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Core {
+
+/** CPUs to bind each of num_threads threads to under mode ("numa" or
+ * "core"), chosen from the CPUs this process may run on.  Neighboring
+ * threads go to the same NUMA node.  Ranks on the same node that may
+ * run on the same CPUs divide them between them, so every rank has to
+ * call this.  Returns an empty list, with the reason in why, if the
+ * threads should not be bound. */
+std::vector<std::vector<int> > threadCpuSets(const std::string& mode, uint32_t num_threads, std::string& why);
+
+/** Bind the calling thread to cpus, returning false if it could not */
+bool pinThread(const std::vector<int>& cpus);
+
+}
+}
+
+
+#endif
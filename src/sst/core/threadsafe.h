@@ -326,6 +326,126 @@ public:
 
 };
 
+/**
+ * Unbounded, lock-free queue with many producers and a single
+ * consumer.  Each producer is given its own Lane, a single-producer
+ * ring of fixed size blocks, so producers never contend with each
+ * other.  Blocks the consumer has emptied are handed back to the
+ * producer for reuse.  drain() takes everything that has been
+ * published, lane by lane, in the order each lane was written.
+ */
+template<typename T, size_t BLOCK = 1024>
+class MPSCQueue {
+public:
+    class CACHE_ALIGNED_T Lane {
+        struct Block {
+            std::atomic<Block*> next;
+            T data[BLOCK];
+
+            Block() : next(nullptr) { }
+        };
+
+        /* Producer side */
+        CACHE_ALIGNED(Block*, tail);
+        size_t tailIdx;
+        /* Number of items published, only written by the producer */
+        CACHE_ALIGNED(std::atomic<size_t>, wPos);
+        /* Emptied block waiting to be reused by the producer */
+        CACHE_ALIGNED(std::atomic<Block*>, spare);
+        /* Consumer side */
+        CACHE_ALIGNED(Block*, head);
+        size_t headIdx;
+        size_t rPos;
+
+        friend class MPSCQueue;
+
+    public:
+        Lane() : tailIdx(0), wPos(0), spare(nullptr), headIdx(0), rPos(0) {
+            head = tail = new Block();
+        }
+
+        ~Lane() {
+            while ( head != nullptr ) {
+                Block* tmp = head;
+                head = tmp->next.load();
+                delete tmp;
+            }
+            delete spare.load();
+        }
+
+        /** Add an item.  Only called by the lane's producer */
+        void push(const T& t) {
+            if ( tailIdx == BLOCK ) {
+                Block* b = spare.exchange(nullptr, std::memory_order_acquire);
+                if ( b == nullptr ) b = new Block();
+                else b->next.store(nullptr, std::memory_order_relaxed);
+                tail->next.store(b, std::memory_order_release);
+                tail = b;
+                tailIdx = 0;
+            }
+            tail->data[tailIdx++] = t;
+            wPos.store(wPos.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        bool empty() const {
+            return rPos == wPos.load(std::memory_order_acquire);
+        }
+
+    private:
+        template<typename FUNC>
+        size_t drain(FUNC& func) {
+            size_t end = wPos.load(std::memory_order_acquire);
+            size_t count = end - rPos;
+            while ( rPos != end ) {
+                if ( headIdx == BLOCK ) {
+                    // The producer has moved on to the next block, so
+                    // this one can be handed back
+                    Block* done = head;
+                    head = head->next.load(std::memory_order_acquire);
+                    headIdx = 0;
+                    delete spare.exchange(done, std::memory_order_release);
+                }
+                func(head->data[headIdx++]);
+                rPos++;
+            }
+            return count;
+        }
+    };
+
+    MPSCQueue(size_t producers) : nLanes(producers) {
+        lanes = new Lane[nLanes];
+    }
+
+    ~MPSCQueue() {
+        delete [] lanes;
+    }
+
+    /** Returns the lane for a producer */
+    Lane* getLane(size_t producer) { return &lanes[producer]; }
+
+    bool empty() const {
+        for ( size_t i = 0; i < nLanes; i++ ) {
+            if ( !lanes[i].empty() ) return false;
+        }
+        return true;
+    }
+
+    /** Pass every published item to func.  Only called by the consumer
+     * @return number of items drained */
+    template<typename FUNC>
+    size_t drain(FUNC func) {
+        size_t count = 0;
+        for ( size_t i = 0; i < nLanes; i++ ) {
+            count += lanes[i].drain(func);
+        }
+        return count;
+    }
+
+private:
+    size_t nLanes;
+    Lane* lanes;
+};
+
 }
 }
 }